@@ -0,0 +1,474 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+/// A spatial index of a set of (axis aligned) boxes, shared by the
+/// implementations in this repository : impl1 indexes the motif positions
+/// of its zones, impl2 the pad groups of its segmentations and the
+/// detection elements of its chambers.
+
+#ifndef O2_MCH_MAPPING_BOXGRID_H
+#define O2_MCH_MAPPING_BOXGRID_H
+
+#include "memoryUsage.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace o2 {
+namespace mch {
+namespace mapping {
+
+/// An axis split into cells of equal length
+template<typename T>
+class UniformAxis
+{
+  public:
+    using value_type = T;
+
+    static constexpr int MaxNofCells{256};
+
+    /// Split [vmin,vmax] into cells about typicalLength long
+    /// (a single cell if either length is not positive)
+    UniformAxis(T vmin, T vmax, T typicalLength)
+      : mMin{vmin}, mNofCells{1}, mCellLength{0}, mInverseCellLength{0}
+    {
+      if (vmax > vmin && typicalLength > 0) {
+        mNofCells = static_cast<int>(std::min<T>(MaxNofCells, std::max<T>(1, std::ceil((vmax - vmin) / typicalLength))));
+      }
+      if (vmax > vmin) {
+        mCellLength = (vmax - vmin) / mNofCells;
+        mInverseCellLength = mNofCells / (vmax - vmin);
+      }
+    }
+
+    int nofCells() const
+    { return mNofCells; }
+
+    /// Return the index of the cell containing v, or -1 if v
+    /// is outside of the axis (or is a NaN)
+    int cellIndex(T v) const
+    {
+      T f = (v - mMin) * mInverseCellLength;
+      if (!(f >= 0 && f <= mNofCells)) {
+        return -1;
+      }
+      return std::min(static_cast<int>(f), mNofCells - 1);
+    }
+
+    /// Return the (first,last) cells overlapping [vmin,vmax],
+    /// positions beyond the axis ends belonging to the end cells
+    std::pair<int, int> cellRange(T vmin, T vmax) const
+    { return {clampedCellIndex(vmin), clampedCellIndex(vmax)}; }
+
+    /// Return the lower limit of the i-th cell, the first cell
+    /// being unbounded (see cellRange)
+    T cellMin(int i) const
+    { return i > 0 ? mMin + i * mCellLength : std::numeric_limits<T>::lowest(); }
+
+    /// Return the upper limit of the i-th cell, the last cell
+    /// being unbounded (see cellRange)
+    T cellMax(int i) const
+    { return i < mNofCells - 1 ? mMin + (i + 1) * mCellLength : std::numeric_limits<T>::max(); }
+
+    std::size_t heapMemoryUsage() const
+    { return 0; }
+
+  private:
+    int clampedCellIndex(T v) const
+    {
+      T f = (v - mMin) * mInverseCellLength;
+      if (!(f > 0)) {
+        return 0;
+      }
+      return f < mNofCells ? static_cast<int>(f) : mNofCells - 1;
+    }
+
+  private:
+    T mMin;
+    int mNofCells;
+    T mCellLength;
+    T mInverseCellLength;
+};
+
+template<typename T>
+constexpr int UniformAxis<T>::MaxNofCells;
+
+/// An axis split into the cells delimited by a sorted list of
+/// positions (cuts), i.e. cell i spans [cuts[i],cuts[i+1][ (the last
+/// one being closed)
+template<typename T>
+class CutsAxis
+{
+  public:
+    using value_type = T;
+
+    explicit CutsAxis(std::vector<T> cuts) : mCuts{std::move(cuts)}
+    {
+      if (mCuts.size() < 2) {
+        mCuts.clear();
+      }
+    }
+
+    int nofCells() const
+    { return mCuts.empty() ? 0 : mCuts.size() - 1; }
+
+    /// Return the index of the cell containing v, i.e. of the last cut <= v,
+    /// or -1 if v is outside of the cuts (or is a NaN)
+    int cellIndex(T v) const
+    {
+      if (mCuts.empty() || !(v >= mCuts.front() && v <= mCuts.back())) {
+        return -1;
+      }
+      // branchless binary search (the ternary becomes a conditional move)
+      const T *base = mCuts.data();
+      int n = mCuts.size() - 1;
+      while (n > 1) {
+        int half = n / 2;
+        base = base[half] <= v ? base + half : base;
+        n -= half;
+      }
+      return base - mCuts.data();
+    }
+
+    /// Return the (first,last) cells overlapping ]vmin,vmax[ (or the cell
+    /// of vmin if vmin == vmax), positions beyond the axis ends belonging
+    /// to the end cells.
+    ///
+    /// For a [vmin,vmax] box whose ends are cuts, a position right on vmax
+    /// is looked up in the next cell only. That is harmless for pad groups,
+    /// as their contours are enlarged by one micron, so that edge is not
+    /// part of any of their pads.
+    std::pair<int, int> cellRange(T vmin, T vmax) const
+    {
+      int first = std::upper_bound(mCuts.begin(), mCuts.end(), vmin) - mCuts.begin() - 1;
+      int last = std::lower_bound(mCuts.begin(), mCuts.end(), vmax) - mCuts.begin() - 1;
+      first = std::max(0, std::min(nofCells() - 1, first));
+      last = std::max(first, std::min(nofCells() - 1, last));
+      return {first, last};
+    }
+
+    T cellMin(int i) const
+    { return i > 0 ? mCuts[i] : std::numeric_limits<T>::lowest(); }
+
+    T cellMax(int i) const
+    { return i < nofCells() - 1 ? mCuts[i + 1] : std::numeric_limits<T>::max(); }
+
+    std::size_t heapMemoryUsage() const
+    { return o2::mch::mapping::heapMemoryUsage(mCuts); }
+
+  private:
+    std::vector<T> mCuts;
+};
+
+/// The cells of two axes, where each cell references the boxes overlapping it.
+///
+/// The boxes are given as indices 0..n-1, and the candidates of all the
+/// cells are stored in one single vector (compressed sparse row layout),
+/// in increasing box index order, so a lookup is a cell index computation
+/// per axis and no allocation.
+///
+/// AXIS is UniformAxis (a uniform grid) or CutsAxis.
+template<typename AXIS>
+class BoxGrid
+{
+  public:
+    using value_type = typename AXIS::value_type;
+    using T = value_type;
+
+    /// Index the nofBoxes boxes, where boxOf(i) returns the i-th box,
+    /// as an object with xmin(), ymin(), xmax() and ymax() methods
+    template<typename BOXOF>
+    BoxGrid(AXIS x, AXIS y, int nofBoxes, BOXOF &&boxOf);
+
+    int nofCellsX() const
+    { return mX.nofCells(); }
+
+    int nofCellsY() const
+    { return mY.nofCells(); }
+
+    /// Return the [begin,end) range of the indices of the boxes that
+    /// _might_ contain (x,y) (empty if (x,y) is outside of the grid)
+    std::pair<const int *, const int *> candidates(T x, T y) const
+    {
+      int ix = mX.cellIndex(x);
+      int iy = mY.cellIndex(y);
+      if (ix < 0 || iy < 0) {
+        return {nullptr, nullptr};
+      }
+      return cellCandidates(ix + iy * nofCellsX());
+    }
+
+    /// Call func(i) once for each box i that _might_ overlap the area
+    /// [xmin,xmax]x[ymin,ymax]. The boxes are visited cell after cell,
+    /// so not in increasing index order.
+    template<typename FUNC>
+    void forEachCandidate(T xmin, T ymin, T xmax, T ymax, FUNC &&func) const;
+
+    /// Call bound = func(i) for the boxes i of the cells around (x,y),
+    /// ring of cells after ring of cells, until the cells left are all
+    /// further from (x,y) than sqrt(bound). func is typically returning the
+    /// (squared) distance between (x,y) and the closest object found so far.
+    /// Each box is given at most once.
+    template<typename FUNC>
+    void forEachCandidateNear(T x, T y, FUNC &&func) const;
+
+    /// Return the number of bytes owned by this grid (excluding its sizeof)
+    std::size_t heapMemoryUsage() const
+    {
+      using o2::mch::mapping::heapMemoryUsage;
+      return mX.heapMemoryUsage() + mY.heapMemoryUsage() + heapMemoryUsage(mCellOffsets) +
+             heapMemoryUsage(mBoxIndices) + heapMemoryUsage(mFirstCells) + heapMemoryUsage(mLastCells);
+    }
+
+  private:
+    std::pair<const int *, const int *> cellCandidates(int cell) const
+    { return {mBoxIndices.data() + mCellOffsets[cell], mBoxIndices.data() + mCellOffsets[cell + 1]}; }
+
+    /// Return the distance between v and the i-th cell of the axis
+    static T axisDistance(const AXIS &axis, int i, T v)
+    { return std::max({axis.cellMin(i) - v, T{0}, v - axis.cellMax(i)}); }
+
+    static T squared(T v)
+    { return v * v; }
+
+  private:
+    AXIS mX;
+    AXIS mY;
+    std::vector<int> mCellOffsets;
+    std::vector<int> mBoxIndices;
+    std::vector<std::pair<int, int>> mFirstCells; // (ix,iy) of the first cell of each box
+    std::vector<std::pair<int, int>> mLastCells;  // (ix,iy) of the last cell of each box
+};
+
+template<typename AXIS>
+template<typename BOXOF>
+BoxGrid<AXIS>::BoxGrid(AXIS x, AXIS y, int nofBoxes, BOXOF &&boxOf)
+  : mX{std::move(x)}, mY{std::move(y)}, mCellOffsets{}, mBoxIndices{}, mFirstCells{}, mLastCells{}
+{
+  const int nofCells{nofCellsX() * nofCellsY()};
+  mCellOffsets.resize(nofCells + 1, 0);
+  if (nofCells == 0) {
+    return;
+  }
+
+  mFirstCells.reserve(nofBoxes);
+  mLastCells.reserve(nofBoxes);
+  for (auto i = 0; i < nofBoxes; ++i) {
+    const auto &b = boxOf(i);
+    auto rx = mX.cellRange(b.xmin(), b.xmax());
+    auto ry = mY.cellRange(b.ymin(), b.ymax());
+    mFirstCells.emplace_back(rx.first, ry.first);
+    mLastCells.emplace_back(rx.second, ry.second);
+  }
+
+  auto forEachCell = [this](int i, auto &&f) {
+    for (int iy = mFirstCells[i].second; iy <= mLastCells[i].second; ++iy) {
+      for (int ix = mFirstCells[i].first; ix <= mLastCells[i].first; ++ix) {
+        f(ix + iy * nofCellsX());
+      }
+    }
+  };
+
+  // first pass to count the candidates of each cell, second pass to fill them
+  for (auto i = 0; i < nofBoxes; ++i) {
+    forEachCell(i, [this](int cell) { ++mCellOffsets[cell + 1]; });
+  }
+  for (auto i = 1; i < mCellOffsets.size(); ++i) {
+    mCellOffsets[i] += mCellOffsets[i - 1];
+  }
+
+  mBoxIndices.resize(mCellOffsets.back());
+  std::vector<int> fill{mCellOffsets.begin(), mCellOffsets.end() - 1};
+  for (auto i = 0; i < nofBoxes; ++i) {
+    forEachCell(i, [this, &fill, i](int cell) { mBoxIndices[fill[cell]++] = i; });
+  }
+}
+
+template<typename AXIS>
+template<typename FUNC>
+void BoxGrid<AXIS>::forEachCandidate(T xmin, T ymin, T xmax, T ymax, FUNC &&func) const
+{
+  // written so that a NaN is rejected as well
+  if (mBoxIndices.empty() || !(xmin <= xmax && ymin <= ymax)) {
+    return;
+  }
+  auto rx = mX.cellRange(xmin, xmax);
+  auto ry = mY.cellRange(ymin, ymax);
+  for (int iy = ry.first; iy <= ry.second; ++iy) {
+    for (int ix = rx.first; ix <= rx.second; ++ix) {
+      auto c = cellCandidates(ix + iy * nofCellsX());
+      for (auto it = c.first; it != c.second; ++it) {
+        // a box overlapping several cells of the area is only
+        // reported in the first (bottom left) of those cells
+        auto &first = mFirstCells[*it];
+        if (ix == std::max(first.first, rx.first) && iy == std::max(first.second, ry.first)) {
+          func(*it);
+        }
+      }
+    }
+  }
+}
+
+template<typename AXIS>
+template<typename FUNC>
+void BoxGrid<AXIS>::forEachCandidateNear(T x, T y, FUNC &&func) const
+{
+  if (mBoxIndices.empty() || std::isnan(x) || std::isnan(y)) {
+    return;
+  }
+  // the distance between (x,y) and a cell grows with the distance (in cells)
+  // between that cell and the one of (x,y), so the rings can be searched
+  // by increasing distance, until a ring is entirely beyond the bound.
+  // Along each side of a ring, the cells are walked from the middle
+  // outwards, until they are beyond the bound.
+  const int cx = mX.cellRange(x, x).first;
+  const int cy = mY.cellRange(y, y).first;
+  T bound{std::numeric_limits<T>::max()};
+
+  // a box overlapping several cells is only reported in the one of
+  // those cells the closest to (x,y), which is visited first
+  auto visitCell = [this, &func, &bound, cx, cy](int ix, int iy) {
+    auto c = cellCandidates(ix + iy * nofCellsX());
+    for (auto it = c.first; it != c.second; ++it) {
+      auto &first = mFirstCells[*it];
+      auto &last = mLastCells[*it];
+      if (ix == std::min(std::max(cx, first.first), last.first) &&
+          iy == std::min(std::max(cy, first.second), last.second)) {
+        bound = std::min(bound, static_cast<T>(func(*it)));
+      }
+    }
+  };
+
+  // visit the cells (i,j) of a ring side, for i within [imin,imax],
+  // where dj2 is the squared distance to the cells of that side along j
+  auto visitSide = [&bound](int ci, int imin, int imax, T dj2, auto &&distance2, auto &&visit) {
+    for (int i = std::max(ci, imin); i <= imax && dj2 + distance2(i) <= bound; ++i) {
+      visit(i);
+    }
+    for (int i = std::min(ci - 1, imax); i >= imin && dj2 + distance2(i) <= bound; --i) {
+      visit(i);
+    }
+  };
+
+  auto dx2 = [this, x](int ix) { return squared(axisDistance(mX, ix, x)); };
+  auto dy2 = [this, y](int iy) { return squared(axisDistance(mY, iy, y)); };
+
+  const int maxRing = std::max({cx, nofCellsX() - 1 - cx, cy, nofCellsY() - 1 - cy});
+  for (int ring = 0; ring <= maxRing; ++ring) {
+    bool inBound{false};
+    const int xmin = std::max(0, cx - ring);
+    const int xmax = std::min(nofCellsX() - 1, cx + ring);
+    // bottom and top rows of the ring (including its corners)
+    for (int iy: {cy - ring, cy + ring}) {
+      if (iy < 0 || iy >= nofCellsY() || dy2(iy) > bound) {
+        continue;
+      }
+      inBound = true;
+      T d2 = dy2(iy);
+      visitSide(cx, xmin, xmax, d2, dx2, [&visitCell, iy](int ix) { visitCell(ix, iy); });
+      if (ring == 0) {
+        break;
+      }
+    }
+    // left and right columns of the ring (excluding its corners)
+    const int ymin = std::max(0, cy - ring + 1);
+    const int ymax = std::min(nofCellsY() - 1, cy + ring - 1);
+    for (int ix: {cx - ring, cx + ring}) {
+      if (ring == 0 || ix < 0 || ix >= nofCellsX() || dx2(ix) > bound) {
+        continue;
+      }
+      inBound = true;
+      T d2 = dx2(ix);
+      visitSide(cy, ymin, ymax, d2, dy2, [&visitCell, ix](int iy) { visitCell(ix, iy); });
+    }
+    if (!inBound) {
+      return;
+    }
+  }
+}
+
+/// Return a uniform grid of the nofBoxes boxes given by boxOf (see BoxGrid),
+/// covering their bounding box.
+///
+/// Cells are made about the size of a typical (median) box,
+/// so each cell overlaps with only a couple of boxes.
+template<typename T, typename BOXOF>
+BoxGrid<UniformAxis<T>> createUniformBoxGrid(int nofBoxes, BOXOF &&boxOf)
+{
+  T xmin{0};
+  T ymin{0};
+  T xmax{0};
+  T ymax{0};
+  std::vector<T> widths;
+  std::vector<T> heights;
+  for (auto i = 0; i < nofBoxes; ++i) {
+    const auto &b = boxOf(i);
+    xmin = i ? std::min<T>(xmin, b.xmin()) : b.xmin();
+    ymin = i ? std::min<T>(ymin, b.ymin()) : b.ymin();
+    xmax = i ? std::max<T>(xmax, b.xmax()) : b.xmax();
+    ymax = i ? std::max<T>(ymax, b.ymax()) : b.ymax();
+    widths.push_back(b.xmax() - b.xmin());
+    heights.push_back(b.ymax() - b.ymin());
+  }
+  auto median = [](std::vector<T> &v) {
+    if (v.empty()) {
+      return T{0};
+    }
+    auto middle = v.begin() + v.size() / 2;
+    std::nth_element(v.begin(), middle, v.end());
+    return *middle;
+  };
+  return {UniformAxis<T>{xmin, xmax, median(widths)}, UniformAxis<T>{ymin, ymax, median(heights)}, nofBoxes,
+          std::forward<BOXOF>(boxOf)};
+}
+
+/// Return a grid of the nofBoxes boxes given by boxOf (see BoxGrid),
+/// whose cells are delimited by the x- and y-boundaries of the boxes.
+///
+/// Well suited to boxes aligned in columns and rows (e.g. the pad groups
+/// of slats) : there are then only a few tens of cuts, so a lookup is a
+/// short branchless binary search per axis, and most cells hold a single box.
+/// It is not for irregular layouts though, which would give far too many cells.
+template<typename T, typename BOXOF>
+BoxGrid<CutsAxis<T>> createCutsBoxGrid(int nofBoxes, BOXOF &&boxOf)
+{
+  std::vector<T> cutsX;
+  std::vector<T> cutsY;
+  for (auto i = 0; i < nofBoxes; ++i) {
+    const auto &b = boxOf(i);
+    cutsX.push_back(b.xmin());
+    cutsX.push_back(b.xmax());
+    cutsY.push_back(b.ymin());
+    cutsY.push_back(b.ymax());
+  }
+  auto sortUnique = [](std::vector<T> &v) {
+    std::sort(v.begin(), v.end());
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+  };
+  sortUnique(cutsX);
+  sortUnique(cutsY);
+  if (cutsX.size() < 2 || cutsY.size() < 2) {
+    cutsX.clear();
+    cutsY.clear();
+  }
+  return {CutsAxis<T>{std::move(cutsX)}, CutsAxis<T>{std::move(cutsY)}, nofBoxes, std::forward<BOXOF>(boxOf)};
+}
+
+}
+}
+}
+
+#endif
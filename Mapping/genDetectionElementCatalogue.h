@@ -0,0 +1,236 @@
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See http://alice-o2.web.cern.ch/license for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+#ifndef O2_MCH_MAPPING_GENDETECTIONELEMENTCATALOGUE_H
+#define O2_MCH_MAPPING_GENDETECTIONELEMENTCATALOGUE_H
+
+//
+// This file has been generated. Do not modify it by hand or your changes might be lost.
+//
+#include <array>
+
+namespace o2 {
+namespace mch {
+namespace mapping {
+
+/// Static description of a detection element
+struct DetectionElementInfo
+{
+    int detElemId;
+    int chamberId; ///< 1..NofChambers, i.e. detElemId/100
+    int segType;
+    int nofBendingPads;
+    int nofNonBendingPads;
+    int nofBendingDualSampas;
+    int nofNonBendingDualSampas;
+};
+
+constexpr int NofDetectionElements{156};
+constexpr int NofSegTypes{21};
+constexpr int NofChambers{10};
+constexpr int MaxNofDetectionElementsPerChamber{26};
+
+/// All the detection elements, in detElemId order (the position in this array being the detElemIndex)
+constexpr std::array<DetectionElementInfo, NofDetectionElements> detectionElements{{
+  {100, 1, 0, 14392, 14280, 226, 225},
+  {101, 1, 0, 14392, 14280, 226, 225},
+  {102, 1, 0, 14392, 14280, 226, 225},
+  {103, 1, 0, 14392, 14280, 226, 225},
+  {200, 2, 0, 14392, 14280, 226, 225},
+  {201, 2, 0, 14392, 14280, 226, 225},
+  {202, 2, 0, 14392, 14280, 226, 225},
+  {203, 2, 0, 14392, 14280, 226, 225},
+  {300, 3, 1, 13947, 13986, 221, 222},
+  {301, 3, 1, 13947, 13986, 221, 222},
+  {302, 3, 1, 13947, 13986, 221, 222},
+  {303, 3, 1, 13947, 13986, 221, 222},
+  {400, 4, 1, 13947, 13986, 221, 222},
+  {401, 4, 1, 13947, 13986, 221, 222},
+  {402, 4, 1, 13947, 13986, 221, 222},
+  {403, 4, 1, 13947, 13986, 221, 222},
+  {500, 5, 2, 2928, 2048, 46, 32},
+  {501, 5, 3, 3568, 2496, 56, 39},
+  {502, 5, 4, 3120, 2176, 49, 34},
+  {503, 5, 5, 1920, 1344, 30, 21},
+  {504, 5, 6, 1280, 896, 20, 14},
+  {505, 5, 6, 1280, 896, 20, 14},
+  {506, 5, 5, 1920, 1344, 30, 21},
+  {507, 5, 4, 3120, 2176, 49, 34},
+  {508, 5, 3, 3568, 2496, 56, 39},
+  {509, 5, 2, 2928, 2048, 46, 32},
+  {510, 5, 3, 3568, 2496, 56, 39},
+  {511, 5, 4, 3120, 2176, 49, 34},
+  {512, 5, 5, 1920, 1344, 30, 21},
+  {513, 5, 6, 1280, 896, 20, 14},
+  {514, 5, 6, 1280, 896, 20, 14},
+  {515, 5, 5, 1920, 1344, 30, 21},
+  {516, 5, 4, 3120, 2176, 49, 34},
+  {517, 5, 3, 3568, 2496, 56, 39},
+  {600, 6, 7, 3008, 2112, 47, 33},
+  {601, 6, 8, 3648, 2560, 57, 40},
+  {602, 6, 9, 3200, 2240, 50, 35},
+  {603, 6, 5, 1920, 1344, 30, 21},
+  {604, 6, 6, 1280, 896, 20, 14},
+  {605, 6, 6, 1280, 896, 20, 14},
+  {606, 6, 5, 1920, 1344, 30, 21},
+  {607, 6, 9, 3200, 2240, 50, 35},
+  {608, 6, 8, 3648, 2560, 57, 40},
+  {609, 6, 7, 3008, 2112, 47, 33},
+  {610, 6, 8, 3648, 2560, 57, 40},
+  {611, 6, 9, 3200, 2240, 50, 35},
+  {612, 6, 5, 1920, 1344, 30, 21},
+  {613, 6, 6, 1280, 896, 20, 14},
+  {614, 6, 6, 1280, 896, 20, 14},
+  {615, 6, 5, 1920, 1344, 30, 21},
+  {616, 6, 9, 3200, 2240, 50, 35},
+  {617, 6, 8, 3648, 2560, 57, 40},
+  {700, 7, 10, 3200, 2240, 50, 36},
+  {701, 7, 11, 4096, 2880, 64, 46},
+  {702, 7, 12, 4160, 2912, 65, 46},
+  {703, 7, 13, 2560, 1792, 40, 29},
+  {704, 7, 14, 1920, 1344, 30, 22},
+  {705, 7, 15, 960, 672, 15, 12},
+  {706, 7, 16, 640, 448, 10, 8},
+  {707, 7, 16, 640, 448, 10, 8},
+  {708, 7, 15, 960, 672, 15, 12},
+  {709, 7, 14, 1920, 1344, 30, 22},
+  {710, 7, 13, 2560, 1792, 40, 29},
+  {711, 7, 12, 4160, 2912, 65, 46},
+  {712, 7, 11, 4096, 2880, 64, 46},
+  {713, 7, 10, 3200, 2240, 50, 36},
+  {714, 7, 11, 4096, 2880, 64, 46},
+  {715, 7, 12, 4160, 2912, 65, 46},
+  {716, 7, 13, 2560, 1792, 40, 29},
+  {717, 7, 14, 1920, 1344, 30, 22},
+  {718, 7, 15, 960, 672, 15, 12},
+  {719, 7, 16, 640, 448, 10, 8},
+  {720, 7, 16, 640, 448, 10, 8},
+  {721, 7, 15, 960, 672, 15, 12},
+  {722, 7, 14, 1920, 1344, 30, 22},
+  {723, 7, 13, 2560, 1792, 40, 29},
+  {724, 7, 12, 4160, 2912, 65, 46},
+  {725, 7, 11, 4096, 2880, 64, 46},
+  {800, 8, 10, 3200, 2240, 50, 36},
+  {801, 8, 11, 4096, 2880, 64, 46},
+  {802, 8, 12, 4160, 2912, 65, 46},
+  {803, 8, 13, 2560, 1792, 40, 29},
+  {804, 8, 14, 1920, 1344, 30, 22},
+  {805, 8, 15, 960, 672, 15, 12},
+  {806, 8, 16, 640, 448, 10, 8},
+  {807, 8, 16, 640, 448, 10, 8},
+  {808, 8, 15, 960, 672, 15, 12},
+  {809, 8, 14, 1920, 1344, 30, 22},
+  {810, 8, 13, 2560, 1792, 40, 29},
+  {811, 8, 12, 4160, 2912, 65, 46},
+  {812, 8, 11, 4096, 2880, 64, 46},
+  {813, 8, 10, 3200, 2240, 50, 36},
+  {814, 8, 11, 4096, 2880, 64, 46},
+  {815, 8, 12, 4160, 2912, 65, 46},
+  {816, 8, 13, 2560, 1792, 40, 29},
+  {817, 8, 14, 1920, 1344, 30, 22},
+  {818, 8, 15, 960, 672, 15, 12},
+  {819, 8, 16, 640, 448, 10, 8},
+  {820, 8, 16, 640, 448, 10, 8},
+  {821, 8, 15, 960, 672, 15, 12},
+  {822, 8, 14, 1920, 1344, 30, 22},
+  {823, 8, 13, 2560, 1792, 40, 29},
+  {824, 8, 12, 4160, 2912, 65, 46},
+  {825, 8, 11, 4096, 2880, 64, 46},
+  {900, 9, 10, 3200, 2240, 50, 36},
+  {901, 9, 11, 4096, 2880, 64, 46},
+  {902, 9, 17, 4480, 3136, 70, 50},
+  {903, 9, 18, 2880, 2016, 45, 33},
+  {904, 9, 19, 2240, 1568, 35, 26},
+  {905, 9, 20, 1280, 896, 20, 16},
+  {906, 9, 15, 960, 672, 15, 12},
+  {907, 9, 15, 960, 672, 15, 12},
+  {908, 9, 20, 1280, 896, 20, 16},
+  {909, 9, 19, 2240, 1568, 35, 26},
+  {910, 9, 18, 2880, 2016, 45, 33},
+  {911, 9, 17, 4480, 3136, 70, 50},
+  {912, 9, 11, 4096, 2880, 64, 46},
+  {913, 9, 10, 3200, 2240, 50, 36},
+  {914, 9, 11, 4096, 2880, 64, 46},
+  {915, 9, 17, 4480, 3136, 70, 50},
+  {916, 9, 18, 2880, 2016, 45, 33},
+  {917, 9, 19, 2240, 1568, 35, 26},
+  {918, 9, 20, 1280, 896, 20, 16},
+  {919, 9, 15, 960, 672, 15, 12},
+  {920, 9, 15, 960, 672, 15, 12},
+  {921, 9, 20, 1280, 896, 20, 16},
+  {922, 9, 19, 2240, 1568, 35, 26},
+  {923, 9, 18, 2880, 2016, 45, 33},
+  {924, 9, 17, 4480, 3136, 70, 50},
+  {925, 9, 11, 4096, 2880, 64, 46},
+  {1000, 10, 10, 3200, 2240, 50, 36},
+  {1001, 10, 11, 4096, 2880, 64, 46},
+  {1002, 10, 17, 4480, 3136, 70, 50},
+  {1003, 10, 18, 2880, 2016, 45, 33},
+  {1004, 10, 19, 2240, 1568, 35, 26},
+  {1005, 10, 20, 1280, 896, 20, 16},
+  {1006, 10, 15, 960, 672, 15, 12},
+  {1007, 10, 15, 960, 672, 15, 12},
+  {1008, 10, 20, 1280, 896, 20, 16},
+  {1009, 10, 19, 2240, 1568, 35, 26},
+  {1010, 10, 18, 2880, 2016, 45, 33},
+  {1011, 10, 17, 4480, 3136, 70, 50},
+  {1012, 10, 11, 4096, 2880, 64, 46},
+  {1013, 10, 10, 3200, 2240, 50, 36},
+  {1014, 10, 11, 4096, 2880, 64, 46},
+  {1015, 10, 17, 4480, 3136, 70, 50},
+  {1016, 10, 18, 2880, 2016, 45, 33},
+  {1017, 10, 19, 2240, 1568, 35, 26},
+  {1018, 10, 20, 1280, 896, 20, 16},
+  {1019, 10, 15, 960, 672, 15, 12},
+  {1020, 10, 15, 960, 672, 15, 12},
+  {1021, 10, 20, 1280, 896, 20, 16},
+  {1022, 10, 19, 2240, 1568, 35, 26},
+  {1023, 10, 18, 2880, 2016, 45, 33},
+  {1024, 10, 17, 4480, 3136, 70, 50},
+  {1025, 10, 11, 4096, 2880, 64, 46}
+}};
+
+/// detElemIndex of detElemId, at position (detElemId/100-1)*MaxNofDetectionElementsPerChamber+detElemId%100
+/// (-1 where there is no detection element)
+constexpr std::array<int, NofChambers * MaxNofDetectionElementsPerChamber> detElemIdToDetElemIndex{{
+0, 1, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+4, 5, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+8, 9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, -1, -1, -1, -1, -1, -1, -1, -1,
+34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1, -1, -1, -1,
+52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129,
+130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155
+}};
+
+/// One detection element (the first one, in detElemId order) of each segmentation type
+constexpr std::array<int, NofSegTypes> segType2DetElemId{{100, 300, 500, 501, 502, 503, 504, 600, 601, 602, 700, 701, 702, 703, 704, 705, 706, 902, 903, 904, 905}};
+
+/// Return the detElemIndex of detElemId, or -1 if there is no such detection element
+constexpr int detElemIndex(int detElemId)
+{
+  return (detElemId >= 100 && detElemId < (NofChambers + 1) * 100 &&
+          detElemId % 100 < MaxNofDetectionElementsPerChamber)
+         ? detElemIdToDetElemIndex[(detElemId / 100 - 1) * MaxNofDetectionElementsPerChamber + detElemId % 100]
+         : -1;
+}
+
+/// Return the segmentation type of detElemId, or -1 if there is no such detection element
+constexpr int detElemId2SegType(int detElemId)
+{
+  return detElemIndex(detElemId) >= 0 ? detectionElements[detElemIndex(detElemId)].segType : -1;
+}
+
+} // namespace mapping
+} // namespace mch
+} // namespace o2
+
+#endif // O2_MCH_MAPPING_GENDETECTIONELEMENTCATALOGUE_H
\ No newline at end of file
@@ -151,6 +151,8 @@ int berg100ToManu(int berg){
   msg << "berg number " << berg << " is invalid";
   throw std::out_of_range(msg.str());
 }
+constexpr int MotifPositionTrait<0,1>::minDualSampaId;
+constexpr std::array<int16_t,243> MotifPositionTrait<0,1>::dualSampaIndices;
 template<>
 std::array<MotifPositionTwoPadSizes,226> getMotifPositions<0,true>(){
  return {
@@ -381,6 +383,8 @@ std::array<MotifPositionTwoPadSizes,226> getMotifPositions<0,true>(){
     MotifPositionTwoPadSizes {242,5,7,7.56,80.64},
     MotifPositionTwoPadSizes {243,5,7,0,80.64}  };
 }
+constexpr int MotifPositionTrait<0,0>::minDualSampaId;
+constexpr std::array<int16_t,243> MotifPositionTrait<0,0>::dualSampaIndices;
 template<>
 std::array<MotifPositionTwoPadSizes,225> getMotifPositions<0,false>(){
  return {
@@ -610,6 +614,8 @@ std::array<MotifPositionTwoPadSizes,225> getMotifPositions<0,false>(){
     MotifPositionTwoPadSizes {1266,15,8,9.765,80.85,13, {4,6,11,47,9,8,44,43,5,46,10,45,7,42,3,2}},
     MotifPositionTwoPadSizes {1267,15,8,-0.315,80.85,13, {4,6,11,47,9,8,44,43,5,46,10,45,7,42,3,2}}  };
 }
+constexpr int MotifPositionTrait<1,1>::minDualSampaId;
+constexpr std::array<int16_t,254> MotifPositionTrait<1,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,221> getMotifPositions<1,true>(){
  return {
@@ -835,6 +841,8 @@ std::array<MotifPosition,221> getMotifPositions<1,true>(){
     MotifPosition {253,42,11,-1,111.25},
     MotifPosition {254,36,11,-1,95.25}  };
 }
+constexpr int MotifPositionTrait<1,0>::minDualSampaId;
+constexpr std::array<int16_t,255> MotifPositionTrait<1,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,222> getMotifPositions<1,false>(){
  return {
@@ -1061,6 +1069,8 @@ std::array<MotifPosition,222> getMotifPositions<1,false>(){
     MotifPosition {1278,89,10,3.125,95.5},
     MotifPosition {1279,90,10,-0.625,95.5}  };
 }
+constexpr int MotifPositionTrait<2,1>::minDualSampaId;
+constexpr std::array<int16_t,324> MotifPositionTrait<2,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,46> getMotifPositions<2,true>(){
  return {
@@ -1111,6 +1121,8 @@ std::array<MotifPosition,46> getMotifPositions<2,true>(){
     MotifPosition {323,208,9,30,-20},
     MotifPosition {324,167,9,35,-20}  };
 }
+constexpr int MotifPositionTrait<2,0>::minDualSampaId;
+constexpr std::array<int16_t,311> MotifPositionTrait<2,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,32> getMotifPositions<2,false>(){
  return {
@@ -1147,6 +1159,8 @@ std::array<MotifPosition,32> getMotifPositions<2,false>(){
     MotifPosition {1337,173,12,5.714285712,-20},
     MotifPosition {1338,173,12,-3.996802889e-15,-20}  };
 }
+constexpr int MotifPositionTrait<3,1>::minDualSampaId;
+constexpr std::array<int16_t,410> MotifPositionTrait<3,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,56> getMotifPositions<3,true>(){
  return {
@@ -1207,6 +1221,8 @@ std::array<MotifPosition,56> getMotifPositions<3,true>(){
     MotifPosition {412,114,9,42.5,-4},
     MotifPosition {413,116,9,40,-4}  };
 }
+constexpr int MotifPositionTrait<3,0>::minDualSampaId;
+constexpr std::array<int16_t,309> MotifPositionTrait<3,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,39> getMotifPositions<3,false>(){
  return {
@@ -1250,6 +1266,8 @@ std::array<MotifPosition,39> getMotifPositions<3,false>(){
     MotifPosition {1332,122,12,71.42857142,-7.5},
     MotifPosition {1333,123,12,75.7142857,-7.5}  };
 }
+constexpr int MotifPositionTrait<4,1>::minDualSampaId;
+constexpr std::array<int16_t,317> MotifPositionTrait<4,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,49> getMotifPositions<4,true>(){
  return {
@@ -1303,6 +1321,8 @@ std::array<MotifPosition,49> getMotifPositions<4,true>(){
     MotifPosition {316,205,9,-77.5,0},
     MotifPosition {317,164,9,-80,0}  };
 }
+constexpr int MotifPositionTrait<4,0>::minDualSampaId;
+constexpr std::array<int16_t,297> MotifPositionTrait<4,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,34> getMotifPositions<4,false>(){
  return {
@@ -1341,6 +1361,8 @@ std::array<MotifPosition,34> getMotifPositions<4,false>(){
     MotifPosition {1330,169,12,-51.42857144,0},
     MotifPosition {1331,169,12,-45.71428573,0}  };
 }
+constexpr int MotifPositionTrait<5,1>::minDualSampaId;
+constexpr std::array<int16_t,120> MotifPositionTrait<5,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,30> getMotifPositions<5,true>(){
  return {
@@ -1375,6 +1397,8 @@ std::array<MotifPosition,30> getMotifPositions<5,true>(){
     MotifPosition {122,205,14,-55,0},
     MotifPosition {123,164,14,-60,0}  };
 }
+constexpr int MotifPositionTrait<5,0>::minDualSampaId;
+constexpr std::array<int16_t,127> MotifPositionTrait<5,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,21> getMotifPositions<5,false>(){
  return {
@@ -1400,6 +1424,8 @@ std::array<MotifPosition,21> getMotifPositions<5,false>(){
     MotifPosition {1150,189,15,-40.00000001,-5},
     MotifPosition {1151,193,15,-30.00000001,-5}  };
 }
+constexpr int MotifPositionTrait<6,1>::minDualSampaId;
+constexpr std::array<int16_t,111> MotifPositionTrait<6,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,20> getMotifPositions<6,true>(){
  return {
@@ -1424,6 +1450,8 @@ std::array<MotifPosition,20> getMotifPositions<6,true>(){
     MotifPosition {113,205,14,-35,0},
     MotifPosition {114,164,14,-40,0}  };
 }
+constexpr int MotifPositionTrait<6,0>::minDualSampaId;
+constexpr std::array<int16_t,118> MotifPositionTrait<6,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,14> getMotifPositions<6,false>(){
  return {
@@ -1442,6 +1470,8 @@ std::array<MotifPosition,14> getMotifPositions<6,false>(){
     MotifPosition {1141,189,15,-20.00000001,-5},
     MotifPosition {1142,193,15,-10.00000001,-5}  };
 }
+constexpr int MotifPositionTrait<7,1>::minDualSampaId;
+constexpr std::array<int16_t,324> MotifPositionTrait<7,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,47> getMotifPositions<7,true>(){
  return {
@@ -1493,6 +1523,8 @@ std::array<MotifPosition,47> getMotifPositions<7,true>(){
     MotifPosition {323,208,9,30,-20},
     MotifPosition {324,167,9,35,-20}  };
 }
+constexpr int MotifPositionTrait<7,0>::minDualSampaId;
+constexpr std::array<int16_t,311> MotifPositionTrait<7,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,33> getMotifPositions<7,false>(){
  return {
@@ -1530,6 +1562,8 @@ std::array<MotifPosition,33> getMotifPositions<7,false>(){
     MotifPosition {1337,173,12,5.714285712,-20},
     MotifPosition {1338,173,12,-3.996802889e-15,-20}  };
 }
+constexpr int MotifPositionTrait<8,1>::minDualSampaId;
+constexpr std::array<int16_t,410> MotifPositionTrait<8,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,57> getMotifPositions<8,true>(){
  return {
@@ -1591,6 +1625,8 @@ std::array<MotifPosition,57> getMotifPositions<8,true>(){
     MotifPosition {412,114,9,42.5,-4},
     MotifPosition {413,116,9,40,-4}  };
 }
+constexpr int MotifPositionTrait<8,0>::minDualSampaId;
+constexpr std::array<int16_t,309> MotifPositionTrait<8,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,40> getMotifPositions<8,false>(){
  return {
@@ -1635,6 +1671,8 @@ std::array<MotifPosition,40> getMotifPositions<8,false>(){
     MotifPosition {1332,122,12,71.42857142,-7.5},
     MotifPosition {1333,123,12,75.7142857,-7.5}  };
 }
+constexpr int MotifPositionTrait<9,1>::minDualSampaId;
+constexpr std::array<int16_t,317> MotifPositionTrait<9,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,50> getMotifPositions<9,true>(){
  return {
@@ -1689,6 +1727,8 @@ std::array<MotifPosition,50> getMotifPositions<9,true>(){
     MotifPosition {316,205,9,-77.5,0},
     MotifPosition {317,164,9,-80,0}  };
 }
+constexpr int MotifPositionTrait<9,0>::minDualSampaId;
+constexpr std::array<int16_t,297> MotifPositionTrait<9,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,35> getMotifPositions<9,false>(){
  return {
@@ -1728,6 +1768,8 @@ std::array<MotifPosition,35> getMotifPositions<9,false>(){
     MotifPosition {1330,169,12,-51.42857144,0},
     MotifPosition {1331,169,12,-45.71428573,0}  };
 }
+constexpr int MotifPositionTrait<10,1>::minDualSampaId;
+constexpr std::array<int16_t,325> MotifPositionTrait<10,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,50> getMotifPositions<10,true>(){
  return {
@@ -1782,6 +1824,8 @@ std::array<MotifPosition,50> getMotifPositions<10,true>(){
     MotifPosition {324,205,14,-55,0},
     MotifPosition {325,164,14,-60,0}  };
 }
+constexpr int MotifPositionTrait<10,0>::minDualSampaId;
+constexpr std::array<int16_t,310> MotifPositionTrait<10,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,36> getMotifPositions<10,false>(){
  return {
@@ -1822,6 +1866,8 @@ std::array<MotifPosition,36> getMotifPositions<10,false>(){
     MotifPosition {1343,182,15,-45.71428572,0},
     MotifPosition {1344,163,15,-34.2857143,0}  };
 }
+constexpr int MotifPositionTrait<11,1>::minDualSampaId;
+constexpr std::array<int16_t,413> MotifPositionTrait<11,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,64> getMotifPositions<11,true>(){
  return {
@@ -1890,6 +1936,8 @@ std::array<MotifPosition,64> getMotifPositions<11,true>(){
     MotifPosition {412,145,9,82.5,-11.5},
     MotifPosition {413,146,9,80,-11.5}  };
 }
+constexpr int MotifPositionTrait<11,0>::minDualSampaId;
+constexpr std::array<int16_t,335> MotifPositionTrait<11,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,46> getMotifPositions<11,false>(){
  return {
@@ -1940,6 +1988,8 @@ std::array<MotifPosition,46> getMotifPositions<11,false>(){
     MotifPosition {1359,189,15,19.99999999,-5},
     MotifPosition {1360,193,15,29.99999999,-5}  };
 }
+constexpr int MotifPositionTrait<12,1>::minDualSampaId;
+constexpr std::array<int16_t,334> MotifPositionTrait<12,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,65> getMotifPositions<12,true>(){
  return {
@@ -2009,6 +2059,8 @@ std::array<MotifPosition,65> getMotifPositions<12,true>(){
     MotifPosition {333,205,9,-57.5,0},
     MotifPosition {334,164,9,-60,0}  };
 }
+constexpr int MotifPositionTrait<12,0>::minDualSampaId;
+constexpr std::array<int16_t,314> MotifPositionTrait<12,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,46> getMotifPositions<12,false>(){
  return {
@@ -2059,6 +2111,8 @@ std::array<MotifPosition,46> getMotifPositions<12,false>(){
     MotifPosition {1347,169,12,-31.42857144,0},
     MotifPosition {1348,169,12,-25.71428573,0}  };
 }
+constexpr int MotifPositionTrait<13,1>::minDualSampaId;
+constexpr std::array<int16_t,316> MotifPositionTrait<13,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,40> getMotifPositions<13,true>(){
  return {
@@ -2103,6 +2157,8 @@ std::array<MotifPosition,40> getMotifPositions<13,true>(){
     MotifPosition {315,205,14,-55,0},
     MotifPosition {316,164,14,-60,0}  };
 }
+constexpr int MotifPositionTrait<13,0>::minDualSampaId;
+constexpr std::array<int16_t,306> MotifPositionTrait<13,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,29> getMotifPositions<13,false>(){
  return {
@@ -2136,6 +2192,8 @@ std::array<MotifPosition,29> getMotifPositions<13,false>(){
     MotifPosition {1334,182,15,-45.71428572,0},
     MotifPosition {1335,163,15,-34.2857143,0}  };
 }
+constexpr int MotifPositionTrait<14,1>::minDualSampaId;
+constexpr std::array<int16_t,308> MotifPositionTrait<14,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,30> getMotifPositions<14,true>(){
  return {
@@ -2170,6 +2228,8 @@ std::array<MotifPosition,30> getMotifPositions<14,true>(){
     MotifPosition {307,205,14,-75,0},
     MotifPosition {308,164,14,-80,0}  };
 }
+constexpr int MotifPositionTrait<14,0>::minDualSampaId;
+constexpr std::array<int16_t,298> MotifPositionTrait<14,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,22> getMotifPositions<14,false>(){
  return {
@@ -2196,6 +2256,8 @@ std::array<MotifPosition,22> getMotifPositions<14,false>(){
     MotifPosition {1326,182,15,-65.71428572,0},
     MotifPosition {1327,163,15,-54.2857143,0}  };
 }
+constexpr int MotifPositionTrait<15,1>::minDualSampaId;
+constexpr std::array<int16_t,111> MotifPositionTrait<15,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,15> getMotifPositions<15,true>(){
  return {
@@ -2215,6 +2277,8 @@ std::array<MotifPosition,15> getMotifPositions<15,true>(){
     MotifPosition {112,171,16,-50,4},
     MotifPosition {113,168,16,-60,-4}  };
 }
+constexpr int MotifPositionTrait<15,0>::minDualSampaId;
+constexpr std::array<int16_t,115> MotifPositionTrait<15,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,12> getMotifPositions<15,false>(){
  return {
@@ -2231,6 +2295,8 @@ std::array<MotifPosition,12> getMotifPositions<15,false>(){
     MotifPosition {1138,183,17,-60,0},
     MotifPosition {1139,184,17,-40.00000001,0}  };
 }
+constexpr int MotifPositionTrait<16,1>::minDualSampaId;
+constexpr std::array<int16_t,106> MotifPositionTrait<16,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,10> getMotifPositions<16,true>(){
  return {
@@ -2245,6 +2311,8 @@ std::array<MotifPosition,10> getMotifPositions<16,true>(){
     MotifPosition {107,171,16,-30,4},
     MotifPosition {108,168,16,-40,-4}  };
 }
+constexpr int MotifPositionTrait<16,0>::minDualSampaId;
+constexpr std::array<int16_t,110> MotifPositionTrait<16,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,8> getMotifPositions<16,false>(){
  return {
@@ -2257,6 +2325,8 @@ std::array<MotifPosition,8> getMotifPositions<16,false>(){
     MotifPosition {1133,183,17,-40,0},
     MotifPosition {1134,184,17,-20.00000001,0}  };
 }
+constexpr int MotifPositionTrait<17,1>::minDualSampaId;
+constexpr std::array<int16_t,342> MotifPositionTrait<17,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,70> getMotifPositions<17,true>(){
  return {
@@ -2331,6 +2401,8 @@ std::array<MotifPosition,70> getMotifPositions<17,true>(){
     MotifPosition {341,205,14,-35,0},
     MotifPosition {342,164,14,-40,0}  };
 }
+constexpr int MotifPositionTrait<17,0>::minDualSampaId;
+constexpr std::array<int16_t,327> MotifPositionTrait<17,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,50> getMotifPositions<17,false>(){
  return {
@@ -2385,6 +2457,8 @@ std::array<MotifPosition,50> getMotifPositions<17,false>(){
     MotifPosition {1360,182,15,-25.71428572,0},
     MotifPosition {1361,163,15,-14.2857143,0}  };
 }
+constexpr int MotifPositionTrait<18,1>::minDualSampaId;
+constexpr std::array<int16_t,324> MotifPositionTrait<18,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,45> getMotifPositions<18,true>(){
  return {
@@ -2434,6 +2508,8 @@ std::array<MotifPosition,45> getMotifPositions<18,true>(){
     MotifPosition {323,205,14,-35,0},
     MotifPosition {324,164,14,-40,0}  };
 }
+constexpr int MotifPositionTrait<18,0>::minDualSampaId;
+constexpr std::array<int16_t,314> MotifPositionTrait<18,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,33> getMotifPositions<18,false>(){
  return {
@@ -2471,6 +2547,8 @@ std::array<MotifPosition,33> getMotifPositions<18,false>(){
     MotifPosition {1342,182,15,-25.71428572,0},
     MotifPosition {1343,163,15,-14.2857143,0}  };
 }
+constexpr int MotifPositionTrait<19,1>::minDualSampaId;
+constexpr std::array<int16_t,316> MotifPositionTrait<19,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,35> getMotifPositions<19,true>(){
  return {
@@ -2510,6 +2588,8 @@ std::array<MotifPosition,35> getMotifPositions<19,true>(){
     MotifPosition {315,205,14,-55,0},
     MotifPosition {316,164,14,-60,0}  };
 }
+constexpr int MotifPositionTrait<19,0>::minDualSampaId;
+constexpr std::array<int16_t,306> MotifPositionTrait<19,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,26> getMotifPositions<19,false>(){
  return {
@@ -2540,6 +2620,8 @@ std::array<MotifPosition,26> getMotifPositions<19,false>(){
     MotifPosition {1334,182,15,-45.71428572,0},
     MotifPosition {1335,163,15,-34.2857143,0}  };
 }
+constexpr int MotifPositionTrait<20,1>::minDualSampaId;
+constexpr std::array<int16_t,304> MotifPositionTrait<20,1>::dualSampaIndices;
 template<>
 std::array<MotifPosition,20> getMotifPositions<20,true>(){
  return {
@@ -2564,6 +2646,8 @@ std::array<MotifPosition,20> getMotifPositions<20,true>(){
     MotifPosition {303,171,16,-60,4},
     MotifPosition {304,171,16,-80,4}  };
 }
+constexpr int MotifPositionTrait<20,0>::minDualSampaId;
+constexpr std::array<int16_t,299> MotifPositionTrait<20,0>::dualSampaIndices;
 template<>
 std::array<MotifPosition,16> getMotifPositions<20,false>(){
  return {
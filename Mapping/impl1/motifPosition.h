@@ -16,7 +16,14 @@
 #ifndef O2_MCH_MAPPING_IMPL1_MOTIFPOSITION_H
 #define O2_MCH_MAPPING_IMPL1_MOTIFPOSITION_H
 
+#include "memoryUsage.h"
 #include "pad.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include "motifType.h"
 #include "padSize.h"
@@ -27,6 +34,10 @@ namespace mch {
 namespace mapping {
 namespace impl1 {
 
+/// Pads are artificially increased by 1 micron on each side
+/// to avoid gaps between motif positions
+constexpr double PadEnlargement{1E-4};
+
 class MotifPosition
 {
   public:
@@ -60,9 +71,20 @@ class MotifPosition
     int padSizeId() const
     { return mPadSizeId; }
 
+    /// All the pads of this motif position have the same size
+    int padSizeIndex(int /*bergNumber*/) const
+    { return mPadSizeId; }
+
+    /// Size of the grid the pads of this motif position are laid on
+    double gridSizeX() const
+    { return o2::mch::mapping::impl1::padSizeX(mPadSizeId); }
+
+    double gridSizeY() const
+    { return o2::mch::mapping::impl1::padSizeY(mPadSizeId); }
+
     std::vector<Pad> getPads(const MotifType &mt) const
     {
-      const double eps{1E-4}; // artificially increase pad size by 1micron to avoid gaps between motifpositions
+      const double eps{PadEnlargement};
       std::vector<Pad> pads;
       pads.reserve(mt.getNofPads());
       double padsizex{o2::mch::mapping::impl1::padSizeX(mPadSizeId)};
@@ -75,6 +97,10 @@ class MotifPosition
       return pads;
     }
 
+    /// Return the number of bytes owned by this motif position (excluding its sizeof)
+    std::size_t heapMemoryUsage() const
+    { return 0; }
+
   private:
     int mFECId;
     int mMotifTypeId;
@@ -83,6 +109,13 @@ class MotifPosition
     double mPositionY;
 };
 
+/// A motif position whose pads can have two different sizes
+/// (only found in station 1 segmentations).
+///
+/// The pads connected to the berg numbers given to the constructor have
+/// the second pad size, the other ones the first pad size. Those berg
+/// numbers are stored as a bitmask, so the object does not own any memory
+/// and the pad size of a given berg is found in constant time.
 class MotifPositionTwoPadSizes
 {
   public:
@@ -92,15 +125,22 @@ class MotifPositionTwoPadSizes
     }
 
     MotifPositionTwoPadSizes(int f, int m, int p, double x, double y) :
-      mFECId(f), mMotifTypeId(m), mPadSizeId({p}), mPositionX(x), mPositionY(y)
+      mFECId(f), mMotifTypeId(m), mPadSizeId{{p, -1}}, mPositionX(x), mPositionY(y)
     {
     }
 
     MotifPositionTwoPadSizes(int f, int m, int p1, double x, double y,
-                             int p2, std::vector<int> bergnumbers) :
-      mFECId(f), mMotifTypeId(m), mPadSizeId({p1, p2}),
-      mPositionX(x), mPositionY(y), mBergNumbers(bergnumbers)
+                             int p2, std::initializer_list<int> bergnumbers) :
+      mFECId(f), mMotifTypeId(m), mPadSizeId{{p1, p2}},
+      mPositionX(x), mPositionY(y)
     {
+      for (auto b: bergnumbers) {
+        if (b < 0 || b > MotifType::MaxBerg) {
+          throw std::out_of_range("berg number " + std::to_string(b) + " should be between 0 and " +
+                                  std::to_string(MotifType::MaxBerg));
+        }
+        mSecondPadSizeBergs[b / 64] |= uint64_t{1} << (b % 64);
+      }
     }
 
     int FECId() const
@@ -124,16 +164,50 @@ class MotifPositionTwoPadSizes
     { return o2::mch::mapping::impl1::padSizeY(padSizeIndex(bergNumber)); }
 
     bool hasTwoPadSizes() const
-    { return mPadSizeId.size() > 1; }
+    { return mPadSizeId[1] >= 0; }
 
     int padSizeId() const
     { return mPadSizeId[0]; }
 
+    /// Size of the grid the pads of this motif position are laid on,
+    /// i.e. the smallest of its pad sizes (the other pad size being a
+    /// multiple of it)
+    double gridSizeX() const
+    {
+      double size{o2::mch::mapping::impl1::padSizeX(mPadSizeId[0])};
+      if (hasTwoPadSizes()) {
+        size = std::min(size, o2::mch::mapping::impl1::padSizeX(mPadSizeId[1]));
+      }
+      return size;
+    }
+
+    double gridSizeY() const
+    {
+      double size{o2::mch::mapping::impl1::padSizeY(mPadSizeId[0])};
+      if (hasTwoPadSizes()) {
+        size = std::min(size, o2::mch::mapping::impl1::padSizeY(mPadSizeId[1]));
+      }
+      return size;
+    }
+
+    /// Return the pad size id of the pad with the given connector number
+    int padSizeIndex(int bergNumber) const
+    {
+      if (bergNumber >= 0 && bergNumber <= MotifType::MaxBerg &&
+          (mSecondPadSizeBergs[bergNumber / 64] >> (bergNumber % 64)) & 1) {
+        return mPadSizeId[1];
+      }
+      return mPadSizeId[0];
+    }
+
+    /// Return the pads of this motif position, relative to its position,
+    /// in the order of the pads of the motif type, i.e. the i-th pad
+    /// is the one connected to berg mt.getBerg(i)
     std::vector<Pad> getPads(const MotifType &mt) const
     {
       if (hasTwoPadSizes()) {
-        std::vector<Pad> pads;
-        const double eps{1E-4}; // artificially increase pad size by 1micron to avoid gaps between motifpositions
+        std::vector<Pad> pads(mt.getNofPads());
+        const double eps{PadEnlargement};
         double padx{0.0};
         double pady{0.0};
         double padsizey{o2::mch::mapping::impl1::padSizeY(mPadSizeId[0])};
@@ -146,7 +220,7 @@ class MotifPositionTwoPadSizes
               int bergNumber = mt.getBerg(index);
               padsizex = padSizeX(bergNumber);
               padsizey = padSizeY(bergNumber);
-              pads.push_back({padx - eps, pady - eps, padx + padsizex + eps, pady + padsizey + eps});
+              pads[index] = {padx - eps, pady - eps, padx + padsizex + eps, pady + padsizey + eps};
             }
             padx += padsizex;
           }
@@ -159,25 +233,17 @@ class MotifPositionTwoPadSizes
       }
     }
 
-  private:
-
-    int padSizeIndex(int bergNumber) const
-    {
-      if (mPadSizeId.size() > 1) {
-        if (std::find(mBergNumbers.begin(), mBergNumbers.end(), bergNumber) != mBergNumbers.end()) {
-          return mPadSizeId[1];
-        }
-      }
-      return mPadSizeId[0];
-    }
+    /// Return the number of bytes owned by this motif position (excluding its sizeof)
+    std::size_t heapMemoryUsage() const
+    { return 0; }
 
   private:
     int mFECId;
     int mMotifTypeId;
-    std::vector<int> mPadSizeId;
+    std::array<int, 2> mPadSizeId{{-1, -1}}; // second one is -1 if all the pads have the same size
     double mPositionX;
     double mPositionY;
-    std::vector<int> mBergNumbers;
+    std::array<uint64_t, MotifType::MaxBerg / 64 + 1> mSecondPadSizeBergs{}; // bit b set if berg b has the second pad size
 };
 
 template<int VAL, typename MP=MotifPosition, int (*F)(int) = nullptr>
@@ -3,88 +3,87 @@
 
 #include <array>
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <vector>
-#include <array>
 
 namespace o2 {
 namespace mch {
 namespace mapping {
 namespace impl1 {
 
+/// Description of the pads of a motif type : connector (berg) number
+/// and (ix,iy) indices of each pad.
+///
+/// All the lookup tables (extents, berg -> pad and (ix,iy) -> pad) are
+/// generated along with the motif types, so every accessor is O(1)
+/// and the motif types can be constant-initialized.
 class MotifType
 {
   public:
-    MotifType(const std::array<int, 64> &berg, const std::array<int, 64> &ix, const std::array<int, 64> &iy,
-              int nofPads) :
-      mBerg(berg), mIx(ix), mIy(iy), mNofPads(nofPads)
+    /// Largest berg number of the connectors
+    static constexpr int MaxBerg{100};
+
+    /// Largest number of (ix,iy) cells (nofPadsX*nofPadsY) of a motif type
+    static constexpr int MaxNofIndices{256};
+
+    constexpr MotifType(const std::array<int, 64> &berg, const std::array<int, 64> &ix,
+                        const std::array<int, 64> &iy, int nofPads, int nofPadsX, int nofPadsY,
+                        const std::array<int8_t, MaxBerg + 1> &padIdByBerg,
+                        const std::array<int8_t, MaxNofIndices> &padIdByIndices) :
+      mBerg(berg), mIx(ix), mIy(iy), mNofPads(nofPads), mNofPadsX(nofPadsX), mNofPadsY(nofPadsY),
+      mPadIdByBerg(padIdByBerg), mPadIdByIndices(padIdByIndices)
     {}
 
-    int getNofPads() const
+    constexpr int getNofPads() const
     { return mNofPads; }
 
-    int getNofPadsX() const
-    {
-      auto result = std::minmax_element(begin(mIx), end(mIx));
-      return 1 + *result.second - *result.first;
-    }
+    constexpr int getNofPadsX() const
+    { return mNofPadsX; }
 
-    int getNofPadsY() const
-    {
-      auto result = std::minmax_element(begin(mIy), end(mIy));
-      return 1 + *result.second - *result.first;
-    }
+    constexpr int getNofPadsY() const
+    { return mNofPadsY; }
 
-    int getBerg(int i) const
+    constexpr int getBerg(int i) const
     { return mBerg[i]; }
 
-    int getIx(int i) const
+    constexpr int getIx(int i) const
     { return mIx[i]; }
 
-    int getIy(int i) const
+    constexpr int getIy(int i) const
     { return mIy[i]; }
 
     /// Return the index of the pad with connector number = berg
     /// or -1 if not found
-    int padIdByBerg(int berg) const
-    {
-      int r = std::distance(begin(mBerg), std::find(begin(mBerg), end(mBerg), berg));
-      if (r < getNofPads()) { return r; } else { return -1; }
-    }
+    constexpr int padIdByBerg(int berg) const
+    { return (berg < 0 || berg > MaxBerg) ? -1 : mPadIdByBerg[berg]; }
 
-    bool hasPadByBerg(int berg) const
-    {
-      int f = padIdByBerg(berg);
-      return f >= 0 && f < getNofPads();
-    }
+    constexpr bool hasPadByBerg(int berg) const
+    { return padIdByBerg(berg) >= 0; }
 
     /// Return the index of the pad with indices = (ix,iy)
     /// or -1 if not found
-    int padIdByIndices(int ix, int iy) const
+    constexpr int padIdByIndices(int ix, int iy) const
     {
-      for (auto i = 0; i < mNofPads; ++i) {
-        if (mIx[i] == ix && mIy[i] == iy) {
-          return i;
-        }
-      }
-      return -1;
+      return (ix < 0 || iy < 0 || ix >= mNofPadsX || iy >= mNofPadsY) ? -1 : mPadIdByIndices[ix + iy * mNofPadsX];
     }
 
-    bool hasPadByIndices(int ix, int iy) const
-    {
-      int f = padIdByIndices(ix, iy);
-      return f >= 0 && f < getNofPads();
-    }
+    constexpr bool hasPadByIndices(int ix, int iy) const
+    { return padIdByIndices(ix, iy) >= 0; }
 
   private:
     std::array<int, 64> mBerg;
     std::array<int, 64> mIx;
     std::array<int, 64> mIy;
     int mNofPads;
+    int mNofPadsX;
+    int mNofPadsY;
+    std::array<int8_t, MaxBerg + 1> mPadIdByBerg;
+    std::array<int8_t, MaxNofIndices> mPadIdByIndices; // indexed by ix + iy * nofPadsX
 };
 
 using MotifTypeArray = std::array<MotifType, 210>;
-extern MotifTypeArray arrayOfMotifTypes;
+extern const MotifTypeArray arrayOfMotifTypes;
 
 }
 } // namespace mapping
@@ -16,6 +16,7 @@
 #ifndef O2_MCH_MAPPING_IMPL1_PAD_H
 #define O2_MCH_MAPPING_IMPL1_PAD_H
 
+#include <cstdint>
 #include <ostream>
 #include <boost/format.hpp>
 
@@ -71,6 +72,18 @@ struct Pad
     double xTopRight;
     double yTopRight;
 };
+
+/// Compact description of a pad, relative to its motif position.
+///
+/// The pad bottom left corner is at (ix,iy) on the grid of its motif
+/// position (see MotifPosition::gridSizeX/Y), and its size is the one
+/// of the pad size padSizeId.
+struct CompactPad
+{
+    uint8_t ix;
+    uint8_t iy;
+    uint8_t padSizeId;
+};
 }}}}
 
 #endif
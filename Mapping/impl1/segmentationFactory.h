@@ -16,7 +16,11 @@
 #ifndef O2_MCH_MAPPING_IMPL1_SEGMENTATIONFACTORY_H
 #define O2_MCH_MAPPING_IMPL1_SEGMENTATIONFACTORY_H
 
+#include "detectionElementCatalogue.h"
 #include "segmentationImpl1.h"
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace o2 {
 namespace mch {
@@ -33,6 +37,71 @@ std::unique_ptr<SegmentationInterface> getSegmentationByDetElemIndex(int deIndex
 
 std::unique_ptr<SegmentationInterface> getSegmentationByType(int segtype, bool isBendingPlane);
 
+namespace detail {
+
+template<typename CALLABLE>
+using VisitResult = decltype(std::declval<CALLABLE>()(std::declval<const Segmentation<0, true> &>()));
+
+template<int SEGID>
+struct SegmentationVisitor
+{
+    template<typename CALLABLE>
+    static VisitResult<CALLABLE> visit(int segtype, bool isBendingPlane, CALLABLE &&func)
+    {
+      if (segtype != SEGID) {
+        return SegmentationVisitor<SEGID + 1>::visit(segtype, isBendingPlane, std::forward<CALLABLE>(func));
+      }
+      if (isBendingPlane) {
+        const Segmentation<SEGID, true> seg;
+        return func(seg);
+      }
+      const Segmentation<SEGID, false> seg;
+      return func(seg);
+    }
+};
+
+template<>
+struct SegmentationVisitor<NofSegTypes>
+{
+    template<typename CALLABLE>
+    static VisitResult<CALLABLE> visit(int segtype, bool, CALLABLE &&)
+    {
+      throw std::out_of_range(std::to_string(segtype) + " is not a valid segtype");
+    }
+};
+}
+
+/// Call func(seg), where seg is the (const) concrete
+/// Segmentation<SEGID,BENDINGPLANE> of the given segmentation type and plane,
+/// and return what func returns (which must not refer to seg).
+///
+/// func is typically a generic lambda, instantiated for each segmentation
+/// type and plane, within which the calls to seg methods are not virtual
+/// and can be inlined, e.g. :
+///
+///     visitByType(segtype, true, [](const auto &seg) {
+///       double sum{0};
+///       seg.forEachPad([&](int ph) { sum += seg.padPositionX(ph); });
+///       return sum;
+///     });
+template<typename CALLABLE>
+detail::VisitResult<CALLABLE> visitByType(int segtype, bool isBendingPlane, CALLABLE &&func)
+{
+  return detail::SegmentationVisitor<0>::visit(segtype, isBendingPlane, std::forward<CALLABLE>(func));
+}
+
+/// Same as visitByType, for the segmentation of the given plane of a
+/// detection element
+template<typename CALLABLE>
+detail::VisitResult<CALLABLE> visit(int detElemId, bool isBendingPlane, CALLABLE &&func)
+{
+  int segtype = detElemId2SegType(detElemId);
+  if (segtype < 0) {
+    throw std::runtime_error("detElemId" + std::to_string(detElemId) + " is incorrect");
+  }
+  return visitByType(segtype, isBendingPlane, std::forward<CALLABLE>(func));
+}
+
 }
 }
 }
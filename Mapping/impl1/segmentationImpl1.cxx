@@ -14,7 +14,9 @@
 
 #include "impl1_export.h"
 #include "segmentationCInterface.h"
+#include "segmentationCInterfaceExt.h"
 #include "segmentationFactory.h"
+#include "detectionElementCatalogue.h"
 #include <string>
 #include <iostream>
 #include <memory>
@@ -53,11 +55,7 @@ int mchSegmentationId(MchSegmentationHandle segHandle)
 IMPL1_EXPORT
 int mchSegmentationFindPadByPosition(MchSegmentationHandle segHandle, double x, double y)
 {
-  if (segHandle->impl->hasPadByPosition(x, y)) {
-    // todo: should get a valid paduid here
-    return 1;
-  }
-  return -1;
+  return segHandle->impl->findPadByPosition(x, y);
 }
 
 IMPL1_EXPORT
@@ -66,11 +64,20 @@ int mchSegmentationFindPadByFEE(MchSegmentationHandle segHandle, int dualSampaId
   return segHandle->impl->findPadByFEE(dualSampaId,dualSampaChannel);
 }
 
+IMPL1_EXPORT
+void mchSegmentationFindPadByFEEs(MchSegmentationHandle segHandle, int n,
+                                  const int *dualSampaIds, const int *dualSampaChannels, int *paduids)
+{
+  for (auto i = 0; i < n; ++i) {
+    paduids[i] = segHandle->impl->findPadByFEE(dualSampaIds[i], dualSampaChannels[i]);
+  }
+}
+
 IMPL1_EXPORT
 void mchSegmentationForEachDetectionElement(MchDetectionElementHandler handler, void *clientData)
 {
-  for (auto i = 0; i < 156; ++i ) {
-    handler(clientData, o2::mch::mapping::impl1::getDetElemIdFromDetElemIndex(i));
+  for (const auto &de: o2::mch::mapping::impl1::detectionElements) {
+    handler(clientData, de.detElemId);
   }
 }
 
@@ -86,7 +93,7 @@ void mchSegmentationForEachDualSampa(MchSegmentationHandle segHandle, MchDualSam
 IMPL1_EXPORT
 void mchSegmentationForOneDetectionElementOfEachSegmentationType(MchDetectionElementHandler handler, void *clientData)
 {
-  for ( auto detElemId : {100,300,500,501,502,503,504,600,601,602,700,701,702,703,704,705,706,902,903,904,905})
+  for (auto detElemId: o2::mch::mapping::impl1::segType2DetElemId)
   {
     handler(clientData,detElemId);
   }
@@ -98,62 +105,77 @@ int mchSegmentationIsPadValid(MchSegmentationHandle segHandle, int paduid)
   return paduid != -1;
 }
 
+// an unknown dualSampaId visits no pad (see segmentationCInterfaceExt.h)
 IMPL1_EXPORT
 void mchSegmentationForEachPadInDualSampa(MchSegmentationHandle segHandle, int dualSampaId, MchPadHandler handler,
                                           void *clientData)
 {
-  auto pads = segHandle->impl->getPads(dualSampaId);
-  for (auto p: pads) {
-    handler(clientData, p);
-  }
+  o2::mch::mapping::impl1::visitByType(segHandle->impl->getId(), segHandle->impl->isBendingPlane(),
+                                       [=](const auto &seg) {
+                                         seg.forEachPadOfDualSampa(dualSampaId, [=](int ph) {
+                                           handler(clientData, ph);
+                                         });
+                                       });
 }
 
+// the per-pad functions go through getPadAttributes, which gives
+// NaN or -1 (instead of throwing) for an invalid paduid
+
 IMPL1_EXPORT
 double mchSegmentationPadPositionX(MchSegmentationHandle segHandle, int paduid)
 {
-  double x, y;
-  segHandle->impl->getPadPosition(paduid, x, y);
+  double x;
+  segHandle->impl->getPadAttributes(1, &paduid, &x, nullptr, nullptr, nullptr, nullptr, nullptr);
   return x;
 }
 
 IMPL1_EXPORT
 double mchSegmentationPadPositionY(MchSegmentationHandle segHandle, int paduid)
 {
-  double x, y;
-  segHandle->impl->getPadPosition(paduid, x, y);
+  double y;
+  segHandle->impl->getPadAttributes(1, &paduid, nullptr, &y, nullptr, nullptr, nullptr, nullptr);
   return y;
 }
 
 IMPL1_EXPORT
 double mchSegmentationPadSizeX(MchSegmentationHandle segHandle, int paduid)
 {
-  double x, y;
-  segHandle->impl->getPadDimension(paduid, x, y);
-  return x;
+  double dx;
+  segHandle->impl->getPadAttributes(1, &paduid, nullptr, nullptr, &dx, nullptr, nullptr, nullptr);
+  return dx;
 }
 
 IMPL1_EXPORT
 double mchSegmentationPadSizeY(MchSegmentationHandle segHandle, int paduid)
 {
-  double x, y;
-  segHandle->impl->getPadDimension(paduid, x, y);
-  return y;
+  double dy;
+  segHandle->impl->getPadAttributes(1, &paduid, nullptr, nullptr, nullptr, &dy, nullptr, nullptr);
+  return dy;
 }
 
 IMPL1_EXPORT
 int mchSegmentationPadDualSampaId(MchSegmentationHandle segHandle, int paduid)
 {
-  int dualSampaId, dualSampaChannel;
-  segHandle->impl->getPad(paduid,dualSampaId,dualSampaChannel);
+  int dualSampaId;
+  segHandle->impl->getPadAttributes(1, &paduid, nullptr, nullptr, nullptr, nullptr, &dualSampaId, nullptr);
   return dualSampaId;
 }
 
 IMPL1_EXPORT
 int mchSegmentationPadDualSampaChannel(MchSegmentationHandle segHandle, int paduid)
 {
-  int dualSampaId, dualSampaChannel;
-  segHandle->impl->getPad(paduid,dualSampaId,dualSampaChannel);
+  int dualSampaChannel;
+  segHandle->impl->getPadAttributes(1, &paduid, nullptr, nullptr, nullptr, nullptr, nullptr, &dualSampaChannel);
   return dualSampaChannel;
 }
 
+IMPL1_EXPORT
+void mchSegmentationPadAttributes(MchSegmentationHandle segHandle, int n, const int *paduids,
+                                  double *positionX, double *positionY,
+                                  double *sizeX, double *sizeY,
+                                  int *dualSampaIds, int *dualSampaChannels)
+{
+  segHandle->impl->getPadAttributes(n, paduids, positionX, positionY, sizeX, sizeY, dualSampaIds, dualSampaChannels);
+}
+
 } // extern "C"
\ No newline at end of file
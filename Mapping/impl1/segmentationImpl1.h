@@ -1,7 +1,9 @@
 #ifndef O2_MCH_MAPPING_IMPL1_SEGMENTATIONIMPL0_H
 #define O2_MCH_MAPPING_IMPL1_SEGMENTATIONIMPL0_H
 
+#include "boxGrid.h"
 #include "contourCreator.h"
+#include "memoryUsage.h"
 #include "motifPosition.h"
 #include "motifPositionContours.h"
 #include "motifType.h"
@@ -9,12 +11,18 @@
 #include "zone.h"
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
 #include <ostream>
 #include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace o2 {
 namespace mch {
@@ -36,6 +44,10 @@ class SegmentationInterface
 
     virtual bool hasPadByPosition(double x, double y) const = 0;
 
+    /// Return the pad handle (dualSampaIndex*64+dualSampaChannel) of the
+    /// pad containing (x,y), or -1 if there is none
+    virtual int findPadByPosition(double x, double y) const = 0;
+
     virtual bool hasPadByFEE(int dualSampaId, int dualSampaChannel) const = 0;
 
     virtual std::vector<int> getPads(int dualSampaId) const = 0;
@@ -46,7 +58,20 @@ class SegmentationInterface
 
     virtual void getPad(int ph, int& dualSampaId, int& dualSampaChannel) const = 0;
 
+    /// Fill the attributes of the n pads ph[i] into the i-th element of the
+    /// given arrays. Any of the output arrays can be null, in which case
+    /// the corresponding attribute is not retrieved.
+    /// An invalid pad handle ph[i] (e.g. -1) does not throw, but gets NaN
+    /// positions and dimensions, and -1 dual sampa id and channel.
+    virtual void getPadAttributes(int n, const int *ph, double *x, double *y, double *dx, double *dy,
+                                  int *dualSampaIds, int *dualSampaChannels) const = 0;
+
     virtual int findPadByFEE(int dualSampaId, int dualSampaChannel) const = 0;
+
+    /// Return the number of bytes used by this segmentation,
+    /// broken down per member (see MemoryUsage), including the data
+    /// it shares with the other segmentations of the same type and plane
+    virtual MemoryUsage memoryUsage() const = 0;
 };
 
 /// Get the segmentation for the given plane of a detection element
@@ -60,8 +85,14 @@ std::vector<int> getDetElemIds();
 /// Mostly needed by tests.
 std::vector<int> getOneDetElemIdPerSegmentation();
 
+/// The segmentation of one plane of a segmentation type.
+///
+/// Besides the (virtual) SegmentationInterface, it offers non-virtual
+/// per-pad accessors and forEachPad* templates, which are meant to be
+/// used through visit() (see segmentationFactory.h), so that loops over
+/// the pads of a detection element only pay for the dispatch once.
 template<int SEGID, bool BENDINGPLANE>
-class Segmentation : public SegmentationInterface
+class Segmentation final : public SegmentationInterface
 {
   public:
     using MOTIFPOSITION = typename MotifPositionTrait<SEGID, BENDINGPLANE>::type;
@@ -69,14 +100,13 @@ class Segmentation : public SegmentationInterface
 
     int (*berg2channel)(int) = MotifPositionTrait<SEGID, BENDINGPLANE>::func;
 
-    Segmentation(const MotifTypeArray &motifTypes) : mId(SEGID),
-                                                          mIsBendingPlane(BENDINGPLANE),
-                                                          mNofPads{0},
-                                                          mMotifPositions(getMotifPositions<SEGID, BENDINGPLANE>())
-    {
-      populatePads(motifTypes);
-      createContours(motifTypes);
-    }
+    /// The pads, zones and contours of the segmentation are computed
+    /// (from the generated motif types and positions) only once per
+    /// segmentation type and plane, and then shared by all the
+    /// Segmentation<SEGID,BENDINGPLANE> objects, so constructing a
+    /// segmentation is just getting a reference to them.
+    Segmentation() : mId(SEGID), mIsBendingPlane(BENDINGPLANE), mData(sharedData())
+    {}
 
     int getId() const override
     { return mId; }
@@ -89,25 +119,36 @@ class Segmentation : public SegmentationInterface
 
     int nofPads() const override
     {
-      return mNofPads;
+      return mData.mNofPads;
     }
 
     int getSampaId(int dualSampaIndex) const override
     {
-      if (dualSampaIndex > mMotifPositions.size()) {
-        throw std::out_of_range("dualSampaIndex should be between 0 and " + std::to_string(mMotifPositions.size()));
+      if (dualSampaIndex < 0 || dualSampaIndex >= static_cast<int>(mData.mMotifPositions.size())) {
+        throw std::out_of_range("dualSampaIndex should be between 0 and " + std::to_string(mData.mMotifPositions.size()));
       }
-      return mMotifPositions[dualSampaIndex].FECId();
+      return mData.mMotifPositions[dualSampaIndex].FECId();
+    }
+
+    /// Return the index of the dual sampa with the given id,
+    /// or -1 if it is not part of this segmentation
+    int findSampaIndex(int dualSampaId) const
+    {
+      using Trait = MotifPositionTrait<SEGID, BENDINGPLANE>;
+      int i = dualSampaId - Trait::minDualSampaId;
+      if (i < 0 || i >= static_cast<int>(Trait::dualSampaIndices.size())) {
+        return -1;
+      }
+      return Trait::dualSampaIndices[i];
     }
 
     int getSampaIndex(int dualSampaId) const
     {
-      auto it = std::find_if(begin(mMotifPositions), end(mMotifPositions),
-                             [&](const MOTIFPOSITION &mp) { return mp.FECId() == dualSampaId; });
-      if (it == mMotifPositions.end()) {
+      int index = findSampaIndex(dualSampaId);
+      if (index < 0) {
         throw std::out_of_range("dualSampaId" + std::to_string(dualSampaId) + " is not part of this segmentation");
       }
-      return std::distance(mMotifPositions.begin(), it);
+      return index;
     }
 
     bool hasPadByFEE(int dualSampaId, int dualSampaChannel) const override
@@ -115,36 +156,41 @@ class Segmentation : public SegmentationInterface
       return findPadByFEE(dualSampaId,dualSampaChannel) != -1;
     }
 
+    /// Return the pad handle of the pad connected to the given channel of
+    /// the given dual sampa, or -1 if there is no such pad (including for
+    /// an unknown dual sampa or a channel outside of 0..63)
     int findPadByFEE(int dualSampaId, int dualSampaChannel) const override
     {
-      if (dualSampaChannel < 0 || dualSampaChannel > 63) {
-        throw std::out_of_range("dualSampaChannel should be between 0 and 63");
+      int index = findSampaIndex(dualSampaId);
+      if (index < 0 || dualSampaChannel < 0 || dualSampaChannel > 63) {
+        return -1;
       }
-      int index = getSampaIndex(dualSampaId);
-      int padIndex = index * 64 + dualSampaChannel;
-      return mPads[padIndex].isValid() ? padIndex : -1;
+      return mData.hasPad(index, dualSampaChannel) ? index * 64 + dualSampaChannel : -1;
     }
 
     bool hasPadByPosition(double x, double y) const override
+    { return findPadByPosition(x, y) >= 0; }
+
+    int findPadByPosition(double x, double y) const override
     {
-//      for ( const auto& c: mFEContours) {
-//        if (c.contains(x,y)) {
-//          return true;
-//        }
-//      }
-      for (const auto &z : mZones) {
-        if (z.contains(x, y)) {
-          return true;
+      for (const auto &zone: mData.mZoneGrids) {
+        auto candidates = zone.grid.candidates(x, y);
+        for (auto it = candidates.first; it != candidates.second; ++it) {
+          int ph = mData.findPadInMotifPosition(zone.motifPositionIndices[*it], x, y);
+          if (ph >= 0) {
+            return ph;
+          }
         }
       }
-      return false;
+      return -1;
     }
 
     void getPadPosition(int ph, double &x, double &y) const override
     {
-      if (ph < mPads.size()) {
-        x = mPads[ph].positionX();
-        y = mPads[ph].positionY();
+      if (ph < NFEC * 64) {
+        Pad p = mData.pad(ph);
+        x = p.positionX();
+        y = p.positionY();
       } else {
         throw std::range_error("incorrect pad handle");
       }
@@ -152,9 +198,10 @@ class Segmentation : public SegmentationInterface
 
     void getPadDimension(int ph, double &dx, double &dy) const override
     {
-      if (ph < mPads.size()) {
-        dx = mPads[ph].dimensionX();
-        dy = mPads[ph].dimensionY();
+      if (ph < NFEC * 64) {
+        Pad p = mData.pad(ph);
+        dx = p.dimensionX();
+        dy = p.dimensionY();
       } else {
         throw std::range_error("incorrect pad handle");
       }
@@ -163,58 +210,305 @@ class Segmentation : public SegmentationInterface
     std::vector<int> getPads(int dualSampaId) const override
     {
       int index = getSampaIndex(dualSampaId);
-      std::vector<int> pads;
-      for (int i = index * 64; i < (index + 1) * 64; ++i) {
-        if (mPads[i].isValid()) {
-          pads.push_back(i);
-        }
+      return mData.getPadsByIndex(index);
+    }
+
+    /// Call func(ph) for each pad of the segmentation,
+    /// in increasing pad handle order
+    template<typename CALLABLE>
+    void forEachPad(CALLABLE &&func) const
+    {
+      for (int index = 0; index < NFEC; ++index) {
+        mData.forEachPadByIndex(index, func);
       }
-      return pads;
     }
 
+    /// Call func(ph) for each pad of the given dual sampa, in increasing
+    /// pad handle order. Nothing is called if the dual sampa is not part
+    /// of this segmentation.
+    template<typename CALLABLE>
+    void forEachPadOfDualSampa(int dualSampaId, CALLABLE &&func) const
+    {
+      int index = findSampaIndex(dualSampaId);
+      if (index >= 0) {
+        mData.forEachPadByIndex(index, func);
+      }
+    }
+
+    /// Per-pad accessors. Contrary to the virtual methods above,
+    /// the pad handle is not checked, i.e. it must be a valid one
+    /// (e.g. one given by forEachPad or findPadByFEE).
+    double padPositionX(int ph) const
+    { return mData.pad(ph).positionX(); }
+
+    double padPositionY(int ph) const
+    { return mData.pad(ph).positionY(); }
+
+    double padDimensionX(int ph) const
+    { return mData.pad(ph).dimensionX(); }
+
+    double padDimensionY(int ph) const
+    { return mData.pad(ph).dimensionY(); }
+
+    int padDualSampaId(int ph) const
+    { return mData.mMotifPositions[ph / 64].FECId(); }
+
+    int padDualSampaChannel(int ph) const
+    { return ph % 64; }
+
     void getPad(int ph, int& dualSampaId, int& dualSampaChannel) const override {
       //int padIndex = index * 64 + fecChannel;
       int index = ph/64;
-      dualSampaId = mMotifPositions[index].FECId();
+      dualSampaId = mData.mMotifPositions[index].FECId();
       dualSampaChannel = ph - index*64;
     }
 
-  private:
+    /// Whether ph is the handle of an existing pad
+    bool isPadValid(int ph) const
+    { return ph >= 0 && ph < NFEC * 64 && mData.hasPad(ph / 64, ph % 64); }
 
-    void populatePadsForOneMotifPosition(int index, const MOTIFPOSITION &mp, const MotifTypeArray &motifTypes)
+    void getPadAttributes(int n, const int *ph, double *x, double *y, double *dx, double *dy,
+                          int *dualSampaIds, int *dualSampaChannels) const override
     {
-      const MotifType &mt = motifTypes[mp.motifTypeId()];
-      auto pads = o2::mch::mapping::impl1::getPads(mp, mt);
-      for (auto i = 0; i < pads.size(); ++i) {
-        int fecChannel = (*berg2channel)(mt.getBerg(i));
-        int padIndex = index * 64 + fecChannel;
-        mPads[padIndex] = pads[i];
+      constexpr double invalid{std::numeric_limits<double>::quiet_NaN()};
+      for (auto i = 0; i < n; ++i) {
+        bool valid = isPadValid(ph[i]);
+        const Pad pad = valid ? mData.pad(ph[i]) : Pad{};
+        if (x) {
+          x[i] = valid ? pad.positionX() : invalid;
+        }
+        if (y) {
+          y[i] = valid ? pad.positionY() : invalid;
+        }
+        if (dx) {
+          dx[i] = valid ? pad.dimensionX() : invalid;
+        }
+        if (dy) {
+          dy[i] = valid ? pad.dimensionY() : invalid;
+        }
+        if (dualSampaIds) {
+          dualSampaIds[i] = valid ? mData.mMotifPositions[ph[i] / 64].FECId() : -1;
+        }
+        if (dualSampaChannels) {
+          dualSampaChannels[i] = valid ? ph[i] % 64 : -1;
+        }
       }
     }
 
-    void populatePads(const MotifTypeArray &motifTypes)
+    MemoryUsage memoryUsage() const override
     {
-      for (int index = 0; index < mMotifPositions.size(); ++index) {
-        const MOTIFPOSITION &mp = mMotifPositions[index];
-        const MotifType &mt = motifTypes[mp.motifTypeId()];
-        populatePadsForOneMotifPosition(index, mp, motifTypes);
-        mNofPads += mt.getNofPads();
+      std::size_t motifPositions{0};
+      for (const auto &mp: mData.mMotifPositions) {
+        motifPositions += mp.heapMemoryUsage();
+      }
+      std::size_t zones = heapMemoryUsage(mData.mZones);
+      for (const auto &z: mData.mZones) {
+        zones += z.heapMemoryUsage();
       }
+      std::size_t feContours{0};
+      for (const auto &c: mData.mFEContours) {
+        feContours += heapMemoryUsage(c);
+      }
+      std::size_t padSizes = heapMemoryUsage(mData.mPadSizes);
+      std::size_t zoneGrids = heapMemoryUsage(mData.mZoneGrids);
+      for (const auto &z: mData.mZoneGrids) {
+        zoneGrids += heapMemoryUsage(z.motifPositionIndices) + z.grid.heapMemoryUsage();
+      }
+      return {
+        {"object", sizeof(*this)},
+        {"data", sizeof(Data)},
+        {"padSizes", padSizes},
+        {"motifPositions", motifPositions},
+        {"zones", zones},
+        {"feContours", feContours},
+        {"zoneGrids", zoneGrids}
+      };
     }
 
-    void createContours(const MotifTypeArray &motifTypes)
+  private:
+
+    /// The (immutable) data of a segmentation
+    class Data
+    {
+      public:
+        Data() : mNofPads{0}, mMotifTypes(arrayOfMotifTypes), mMotifPositions(getMotifPositions<SEGID, BENDINGPLANE>())
+        {
+          populatePads(mMotifTypes);
+          createContours(mMotifTypes);
+          createZoneGrids();
+        }
+
+        bool hasPad(int dualSampaIndex, int dualSampaChannel) const
+        { return (mPadMasks[dualSampaIndex] >> dualSampaChannel) & 1; }
+
+        /// Call func(ph) for each pad of the dualSampaIndex-th dual sampa,
+        /// iterating over the set bits of its pad mask
+        template<typename CALLABLE>
+        void forEachPadByIndex(int dualSampaIndex, CALLABLE &&func) const
+        {
+          for (uint64_t mask = mPadMasks[dualSampaIndex]; mask; mask &= mask - 1) {
+            func(dualSampaIndex * 64 + __builtin_ctzll(mask));
+          }
+        }
+
+        /// Return the pad handles of the dualSampaIndex-th dual sampa
+        std::vector<int> getPadsByIndex(int dualSampaIndex) const
+        {
+          std::vector<int> pads;
+          forEachPadByIndex(dualSampaIndex, [&pads](int ph) { pads.push_back(ph); });
+          return pads;
+        }
+
+        /// Return the (absolute) geometry of a pad, computed from its compact
+        /// description. Not existing pads are returned as an invalid Pad.
+        Pad pad(int ph) const
+        {
+          int index = ph / 64;
+          if (!hasPad(index, ph % 64)) {
+            return Pad{};
+          }
+          const MOTIFPOSITION &mp = mMotifPositions[index];
+          const CompactPad &cp = mPads[ph];
+          double x = mp.positionX() + cp.ix * mGridSizes[index].first;
+          double y = mp.positionY() + cp.iy * mGridSizes[index].second;
+          return {x - PadEnlargement, y - PadEnlargement,
+                  x + mPadSizes[cp.padSizeId].first + PadEnlargement,
+                  y + mPadSizes[cp.padSizeId].second + PadEnlargement};
+        }
+
+        void populatePadsForOneMotifPosition(int index, const MOTIFPOSITION &mp, const MotifTypeArray &motifTypes)
+        {
+          const MotifType &mt = motifTypes[mp.motifTypeId()];
+          auto pads = mp.getPads(mt); // relative to the motif position
+          double gridSizeX = mp.gridSizeX();
+          double gridSizeY = mp.gridSizeY();
+          mGridSizes[index] = {gridSizeX, gridSizeY};
+          for (auto i = 0; i < pads.size(); ++i) {
+            int fecChannel = MotifPositionTrait<SEGID, BENDINGPLANE>::func(mt.getBerg(i));
+            long ix = std::lround(pads[i].xBottomLeft / gridSizeX);
+            long iy = std::lround(pads[i].yBottomLeft / gridSizeY);
+            if (ix < 0 || iy < 0 || ix > std::numeric_limits<uint8_t>::max() ||
+                iy > std::numeric_limits<uint8_t>::max()) {
+              throw std::out_of_range("pad indices do not fit in a CompactPad");
+            }
+            mPads[index * 64 + fecChannel] = CompactPad{static_cast<uint8_t>(ix), static_cast<uint8_t>(iy),
+                                                        static_cast<uint8_t>(mp.padSizeIndex(mt.getBerg(i)))};
+            mPadMasks[index] |= uint64_t{1} << fecChannel;
+            addPadSize(mp.padSizeIndex(mt.getBerg(i)));
+          }
+        }
+
+        /// Cache the size of the pad size padSizeId, so that pad()
+        /// does not have to get it through padSizeX/Y
+        void addPadSize(int padSizeId)
+        {
+          if (padSizeId >= mPadSizes.size()) {
+            mPadSizes.resize(padSizeId + 1);
+          }
+          mPadSizes[padSizeId] = {o2::mch::mapping::impl1::padSizeX(padSizeId),
+                                  o2::mch::mapping::impl1::padSizeY(padSizeId)};
+        }
+
+        void populatePads(const MotifTypeArray &motifTypes)
+        {
+          mPadMasks.fill(0);
+          for (int index = 0; index < mMotifPositions.size(); ++index) {
+            const MOTIFPOSITION &mp = mMotifPositions[index];
+            const MotifType &mt = motifTypes[mp.motifTypeId()];
+            populatePadsForOneMotifPosition(index, mp, motifTypes);
+            mNofPads += mt.getNofPads();
+          }
+        }
+
+        void createContours(const MotifTypeArray &motifTypes)
+        {
+          mFEContours = o2::mch::mapping::impl1::createMotifPositionContours<MOTIFPOSITION, NFEC>(mMotifPositions, motifTypes);
+          mZones = o2::mch::mapping::impl1::createZones<MOTIFPOSITION, NFEC>(mMotifPositions, motifTypes);
+        }
+
+        /// Index the motif positions of each zone (i.e. of each pad size)
+        /// on a grid, using the bounding boxes of their pads
+        void createZoneGrids()
+        {
+          std::map<int, std::pair<std::vector<o2::mch::contour::BBox<double>>, std::vector<int>>> zones;
+          for (int index = 0; index < mMotifPositions.size(); ++index) {
+            Pad box{std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+                    std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+            for (auto ph: getPadsByIndex(index)) {
+              Pad p = pad(ph);
+              box.xBottomLeft = std::min(box.xBottomLeft, p.xBottomLeft);
+              box.yBottomLeft = std::min(box.yBottomLeft, p.yBottomLeft);
+              box.xTopRight = std::max(box.xTopRight, p.xTopRight);
+              box.yTopRight = std::max(box.yTopRight, p.yTopRight);
+            }
+            auto &zone = zones[mMotifPositions[index].padSizeId()];
+            zone.first.emplace_back(box.xBottomLeft, box.yBottomLeft, box.xTopRight, box.yTopRight);
+            zone.second.push_back(index);
+          }
+          for (const auto &z: zones) {
+            const auto &boxes = z.second.first;
+            mZoneGrids.push_back({z.second.second,
+                                  createUniformBoxGrid<double>(boxes.size(), [&boxes](int i) { return boxes[i]; })});
+          }
+        }
+
+        /// Return the pad handle of the pad of the index-th motif position
+        /// containing (x,y), or -1 if there is none.
+        /// For motif positions with a single pad size the pad is found from
+        /// its (ix,iy) indices within the motif, otherwise the pads
+        /// of the motif position are searched.
+        int findPadInMotifPosition(int index, double x, double y) const
+        {
+          const MOTIFPOSITION &mp = mMotifPositions[index];
+          if (mp.hasTwoPadSizes()) {
+            for (auto ph: getPadsByIndex(index)) {
+              Pad p = pad(ph);
+              if (x >= p.xBottomLeft && x < p.xTopRight && y >= p.yBottomLeft && y < p.yTopRight) {
+                return ph;
+              }
+            }
+            return -1;
+          }
+          const MotifType &mt = mMotifTypes[mp.motifTypeId()];
+          // same grid sizes as in pad(), so both directions of the
+          // position <-> pad relationship agree
+          int ix = static_cast<int>(std::floor((x - mp.positionX()) / mGridSizes[index].first));
+          int iy = static_cast<int>(std::floor((y - mp.positionY()) / mGridSizes[index].second));
+          int padId = mt.padIdByIndices(ix, iy);
+          if (padId < 0) {
+            return -1;
+          }
+          return index * 64 + MotifPositionTrait<SEGID, BENDINGPLANE>::func(mt.getBerg(padId));
+        }
+
+        /// The motif positions of one zone, indexed on a grid
+        struct ZoneGrid
+        {
+            std::vector<int> motifPositionIndices; // indexed by grid box index
+            o2::mch::mapping::BoxGrid<o2::mch::mapping::UniformAxis<double>> grid;
+        };
+
+        int mNofPads;
+        const MotifTypeArray &mMotifTypes;
+        std::array<CompactPad, NFEC * 64> mPads;
+        std::array<uint64_t, NFEC> mPadMasks; // bit i set if channel i of the dual sampa has a pad
+        std::array<std::pair<double, double>, NFEC> mGridSizes; // (x,y) grid size of each motif position
+        std::vector<std::pair<double, double>> mPadSizes; // (x,y) size, indexed by padSizeId
+        typename MotifPositionTrait<SEGID, BENDINGPLANE>::array_type mMotifPositions;
+        std::vector<Zone<MOTIFPOSITION>> mZones;
+        std::array<o2::mch::contour::Contour<double>, NFEC> mFEContours;
+        std::vector<ZoneGrid> mZoneGrids;
+    };
+
+    static const Data &sharedData()
     {
-      mFEContours = o2::mch::mapping::impl1::createMotifPositionContours<MOTIFPOSITION, NFEC>(mMotifPositions, motifTypes);
-      mZones = o2::mch::mapping::impl1::createZones<MOTIFPOSITION, NFEC>(mMotifPositions, motifTypes);
+      static const Data data;
+      return data;
     }
 
     int mId;
     bool mIsBendingPlane;
-    int mNofPads;
-    std::array<Pad, NFEC * 64> mPads;
-    typename MotifPositionTrait<SEGID, BENDINGPLANE>::array_type mMotifPositions;
-    std::vector<Zone<MOTIFPOSITION>> mZones;
-    std::array<o2::mch::contour::Contour<double>, NFEC> mFEContours;
+    const Data &mData;
 };
 
 }
@@ -0,0 +1,74 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#include "benchmark/benchmark.h"
+#include "segmentationFactory.h"
+#include <vector>
+
+using namespace o2::mch::mapping::impl1;
+
+namespace {
+
+// all the (dualSampaId,dualSampaChannel) of a segmentation, including the
+// channels which are not connected to a pad
+std::vector<std::pair<int, int>> allChannels(const SegmentationInterface &seg)
+{
+  std::vector<std::pair<int, int>> channels;
+  for (auto i = 0; i < seg.nofDualSampas(); ++i) {
+    for (auto ch = 0; ch < 64; ++ch) {
+      channels.emplace_back(seg.getSampaId(i), ch);
+    }
+  }
+  return channels;
+}
+}
+
+static void segTypeList(benchmark::internal::Benchmark *b)
+{
+  for (auto segType = 0; segType < 21; ++segType) {
+    for (auto bending : {true, false}) {
+      b->Args({segType, bending});
+    }
+  }
+}
+
+static void benchFindPadByFEE(benchmark::State &state)
+{
+  auto seg = getSegmentationByType(state.range(0), state.range(1));
+  auto channels = allChannels(*seg);
+
+  for (auto _ : state) {
+    for (auto &c: channels) {
+      benchmark::DoNotOptimize(seg->findPadByFEE(c.first, c.second));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * channels.size());
+}
+
+static void benchFindPadByFEEOfUnknownDualSampa(benchmark::State &state)
+{
+  auto seg = getSegmentationByType(state.range(0), state.range(1));
+
+  for (auto _ : state) {
+    for (auto dualSampaId = 2000; dualSampaId < 2064; ++dualSampaId) {
+      benchmark::DoNotOptimize(seg->findPadByFEE(dualSampaId, 0));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 64);
+}
+
+BENCHMARK(benchFindPadByFEE)->Apply(segTypeList);
+BENCHMARK(benchFindPadByFEEOfUnknownDualSampa)->Apply(segTypeList);
+
+BENCHMARK_MAIN();
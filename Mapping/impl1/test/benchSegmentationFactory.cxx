@@ -60,4 +60,4 @@ BENCHMARK(benchSegmentationFactoryByDetElemId)->Apply(detElemIdList)->Unit(bench
 BENCHMARK(benchGetOneDetElemIdPerSegmentation)->Unit(benchmark::kMillisecond);
 BENCHMARK(benchSegmentationFactoryOnce)->Unit(benchmark::kMillisecond);
 
-BENCHMARK_MAIN()
\ No newline at end of file
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,67 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+// Loop over all the pads of all the detection elements, summing their
+// positions, either through the (virtual) SegmentationInterface,
+// or through visit, where the per-pad calls are not virtual.
+
+#include "benchmark/benchmark.h"
+#include "detectionElementCatalogue.h"
+#include "segmentationFactory.h"
+
+using namespace o2::mch::mapping::impl1;
+
+static void benchAllPadsThroughInterface(benchmark::State &state)
+{
+  std::vector<std::unique_ptr<SegmentationInterface>> segs;
+  for (const auto &de: detectionElements) {
+    for (auto bending : {true, false}) {
+      segs.push_back(getSegmentation(de.detElemId, bending));
+    }
+  }
+
+  for (auto _ : state) {
+    double sum{0};
+    for (const auto &seg: segs) {
+      for (auto i = 0; i < seg->nofDualSampas(); ++i) {
+        for (auto ph: seg->getPads(seg->getSampaId(i))) {
+          double x, y;
+          seg->getPadPosition(ph, x, y);
+          sum += x + y;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+static void benchAllPadsThroughVisit(benchmark::State &state)
+{
+  for (auto _ : state) {
+    double sum{0};
+    for (const auto &de: detectionElements) {
+      for (auto bending : {true, false}) {
+        visit(de.detElemId, bending, [&sum](const auto &seg) {
+          seg.forEachPad([&](int ph) { sum += seg.padPositionX(ph) + seg.padPositionY(ph); });
+        });
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+BENCHMARK(benchAllPadsThroughInterface)->Unit(benchmark::kMillisecond);
+BENCHMARK(benchAllPadsThroughVisit)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "segmentationCInterfaceExt.h"
+#include <cmath>
+#include <vector>
+
+namespace {
+
+void appendInt(void *data, int value)
+{
+  static_cast<std::vector<int> *>(data)->push_back(value);
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(c_interface)
+
+BOOST_AUTO_TEST_CASE(InvalidPadUidsGiveNaNOrMinusOneInsteadOfThrowing)
+{
+  auto handle = mchSegmentationConstruct(100, true);
+  std::vector<int> dualSampaIds;
+  mchSegmentationForEachDualSampa(handle, appendInt, &dualSampaIds);
+  int dualSampaId = dualSampaIds.front();
+  std::vector<int> valid;
+  mchSegmentationForEachPadInDualSampa(handle, dualSampaId, appendInt, &valid);
+  BOOST_REQUIRE(!valid.empty());
+
+  // and the handle of a channel of the first dual sampa without pad, if any
+  std::vector<int> invalid{-1, -64, 1 << 30};
+  for (auto paduid = 0; paduid < 64; ++paduid) {
+    if (mchSegmentationFindPadByFEE(handle, dualSampaId, paduid) < 0) {
+      invalid.push_back(paduid);
+      break;
+    }
+  }
+
+  for (auto paduid: invalid) {
+    BOOST_TEST(std::isnan(mchSegmentationPadPositionX(handle, paduid)));
+    BOOST_TEST(std::isnan(mchSegmentationPadPositionY(handle, paduid)));
+    BOOST_TEST(std::isnan(mchSegmentationPadSizeX(handle, paduid)));
+    BOOST_TEST(std::isnan(mchSegmentationPadSizeY(handle, paduid)));
+    BOOST_TEST(mchSegmentationPadDualSampaId(handle, paduid) == -1);
+    BOOST_TEST(mchSegmentationPadDualSampaChannel(handle, paduid) == -1);
+  }
+
+  // invalid pads in the middle of valid ones only affect their own element
+  std::vector<int> paduids{valid.front(), invalid[0], valid.back(), valid.front(), invalid.back()};
+  const int n = paduids.size();
+  std::vector<double> x(n), y(n), dx(n), dy(n);
+  std::vector<int> dsIds(n), channels(n);
+  mchSegmentationPadAttributes(handle, n, paduids.data(), x.data(), y.data(), dx.data(), dy.data(), dsIds.data(),
+                               channels.data());
+  for (auto i = 0; i < n; ++i) {
+    int paduid = paduids[i];
+    BOOST_TEST(std::isnan(x[i]) == std::isnan(mchSegmentationPadPositionX(handle, paduid)));
+    if (!std::isnan(x[i])) {
+      BOOST_TEST(x[i] == mchSegmentationPadPositionX(handle, paduid));
+      BOOST_TEST(y[i] == mchSegmentationPadPositionY(handle, paduid));
+      BOOST_TEST(dx[i] == mchSegmentationPadSizeX(handle, paduid));
+      BOOST_TEST(dy[i] == mchSegmentationPadSizeY(handle, paduid));
+    }
+    BOOST_TEST(dsIds[i] == mchSegmentationPadDualSampaId(handle, paduid));
+    BOOST_TEST(channels[i] == mchSegmentationPadDualSampaChannel(handle, paduid));
+  }
+  mchSegmentationDestruct(handle);
+}
+
+BOOST_AUTO_TEST_CASE(OutOfRangeChannelsHaveNoPadInsteadOfThrowing)
+{
+  auto handle = mchSegmentationConstruct(100, true);
+  std::vector<int> dualSampaIds;
+  mchSegmentationForEachDualSampa(handle, appendInt, &dualSampaIds);
+  std::vector<int> ids(3, dualSampaIds.front());
+  std::vector<int> channels{-1, 64, 1000};
+  std::vector<int> paduids(3, 0);
+  mchSegmentationFindPadByFEEs(handle, 3, ids.data(), channels.data(), paduids.data());
+  for (auto i = 0; i < 3; ++i) {
+    BOOST_TEST(mchSegmentationFindPadByFEE(handle, ids[i], channels[i]) == -1);
+    BOOST_TEST(paduids[i] == -1);
+  }
+  mchSegmentationDestruct(handle);
+}
+
+BOOST_AUTO_TEST_CASE(UnknownDualSampaHasNoPad)
+{
+  auto handle = mchSegmentationConstruct(100, false);
+  for (auto dualSampaId: {-1, 0, 1 << 20}) {
+    std::vector<int> paduids;
+    BOOST_CHECK_NO_THROW(mchSegmentationForEachPadInDualSampa(handle, dualSampaId, appendInt, &paduids));
+    BOOST_TEST(paduids.empty());
+  }
+  mchSegmentationDestruct(handle);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -20,6 +20,7 @@
 #include <array>
 #include <vector>
 #include "segmentationFactory.h"
+#include "detectionElementCatalogue.h"
 
 using namespace o2::mch::mapping::impl1;
 
@@ -51,6 +52,23 @@ BOOST_DATA_TEST_CASE(CircularTest, boost::unit_test::data::xrange(0, 156), deInd
   BOOST_TEST(deIndex == getDetElemIndexFromDetElemId(deId));
 }
 
+BOOST_AUTO_TEST_CASE(GetDetElemIndexFromDetElemIdIsMinusOneForInvalidDetElemId)
+{
+  for (auto deId: {-1, 0, 99, 104, 518, 726, 1026, 1100, 1200}) {
+    BOOST_TEST(getDetElemIndexFromDetElemId(deId) == -1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DetElemIndexIsUsableAtCompileTime)
+{
+  static_assert(detElemIndex(100) == 0, "first detection element");
+  static_assert(detElemIndex(1025) == NofDetectionElements - 1, "last detection element");
+  static_assert(detElemIndex(104) == -1, "no such detection element");
+  static_assert(detElemId2SegType(500) == 2, "first slat");
+  static_assert(detectionElements[detElemIndex(1025)].chamberId == 10, "last chamber");
+  BOOST_TEST(true);
+}
+
 BOOST_AUTO_TEST_CASE(SegmentationByDetElemIdThrowsIfDEIndexIsIncorrect)
 {
   BOOST_CHECK_THROW(getSegmentationByDetElemIndex(-1, true), std::runtime_error);
@@ -84,6 +102,33 @@ BOOST_DATA_TEST_CASE(GetSegmentationByTypeMustNotThrowIfTypeIsBetween0and20, boo
   }
 }
 
+BOOST_AUTO_TEST_CASE(FindPadByFEEOfUnknownDualSampaIsMinusOne)
+{
+  auto seg = getSegmentationByType(5, false);
+  BOOST_TEST(seg->findPadByFEE(1025, 0) >= 0);
+  for (auto dualSampaId: {-1, 0, 1024, 1028, 5000}) {
+    BOOST_TEST(seg->findPadByFEE(dualSampaId, 0) == -1);
+    BOOST_TEST(seg->hasPadByFEE(dualSampaId, 0) == false);
+  }
+  BOOST_CHECK_THROW(seg->getPads(1028), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(FindPadByFEEOfOutOfRangeChannelIsMinusOne)
+{
+  auto seg = getSegmentationByType(5, false);
+  for (auto channel: {-1, 64, 1000}) {
+    BOOST_TEST(seg->findPadByFEE(1025, channel) == -1);
+    BOOST_TEST(seg->hasPadByFEE(1025, channel) == false);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GetSampaIdThrowsForOutOfRangeIndex)
+{
+  auto seg = getSegmentationByType(5, false);
+  BOOST_CHECK_NO_THROW(seg->getSampaId(seg->nofDualSampas() - 1));
+  BOOST_CHECK_THROW(seg->getSampaId(seg->nofDualSampas()), std::out_of_range);
+  BOOST_CHECK_THROW(seg->getSampaId(-1), std::out_of_range);
+}
 
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
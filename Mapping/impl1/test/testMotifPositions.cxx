@@ -22,6 +22,8 @@
 #include "motifPosition.h"
 #include "contour.h"
 #include "motifPositionContours.h"
+#include <stdexcept>
+#include <type_traits>
 
 using namespace o2::mch::mapping::impl1;
 namespace bdata = boost::unit_test::data;
@@ -35,6 +37,49 @@ BOOST_AUTO_TEST_CASE(BergFunctionFromMotifPositionTrait)
   BOOST_CHECK_EQUAL((MotifPositionTrait<16, true>::func) (53), 49);
 }
 
+BOOST_AUTO_TEST_CASE(DualSampaIndicesFromMotifPositionTrait)
+{
+  using Trait = MotifPositionTrait<5, false>;
+  static_assert(Trait::minDualSampaId == 1025, "smallest non-bending dual sampa id of segtype 5");
+  static_assert(Trait::dualSampaIndices[0] == 0, "dual sampa 1025 is the first motif position");
+  auto mps = getMotifPositions<5, false>();
+  for (auto i = 0; i < mps.size(); ++i) {
+    BOOST_CHECK_EQUAL(Trait::dualSampaIndices[mps[i].FECId() - Trait::minDualSampaId], i);
+  }
+  int nofHoles = std::count(Trait::dualSampaIndices.begin(), Trait::dualSampaIndices.end(), -1);
+  BOOST_CHECK_EQUAL(nofHoles + mps.size(), Trait::dualSampaIndices.size());
+}
+
+BOOST_AUTO_TEST_CASE(TwoPadSizesPadSizeIndexFromBergNumbers)
+{
+  MotifPositionTwoPadSizes mp{1, 6, 7, 80.64, 0, 1, {32, 71, 29, 68, 100}};
+  BOOST_TEST(mp.hasTwoPadSizes());
+  for (auto berg: {32, 71, 29, 68, 100}) {
+    BOOST_TEST(mp.padSizeIndex(berg) == 1);
+  }
+  for (auto berg: {-1, 0, 1, 31, 33, 63, 64, 99, 101}) {
+    BOOST_TEST(mp.padSizeIndex(berg) == 7);
+  }
+  MotifPositionTwoPadSizes single{2, 3, 7, 70.56, 0};
+  BOOST_TEST(single.hasTwoPadSizes() == false);
+  BOOST_TEST(single.padSizeIndex(32) == 7);
+}
+
+BOOST_AUTO_TEST_CASE(TwoPadSizesThrowsForInvalidBergNumbers)
+{
+  BOOST_CHECK_THROW((MotifPositionTwoPadSizes{1, 6, 7, 80.64, 0, 1, {-1}}), std::out_of_range);
+  BOOST_CHECK_THROW((MotifPositionTwoPadSizes{1, 6, 7, 80.64, 0, 1, {MotifType::MaxBerg + 1}}), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(TwoPadSizesDoesNotOwnMemory)
+{
+  static_assert(std::is_trivially_copyable<MotifPositionTwoPadSizes>::value,
+                "copying a motif position should not allocate");
+  for (const auto &mp: getMotifPositions<0, true>()) {
+    BOOST_TEST(mp.heapMemoryUsage() == 0);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(NofNonBendingFEC)
 {
   BOOST_CHECK_EQUAL((getMotifPositions<0, false>().size()), 225);
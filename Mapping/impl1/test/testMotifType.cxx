@@ -134,6 +134,20 @@ BOOST_DATA_TEST_CASE(NofPadsInXAndYAreCompatibleWithIxAndIyRanges, boost::unit_t
   BOOST_CHECK_EQUAL(ny, mt.getNofPadsY());
 }
 
+BOOST_DATA_TEST_CASE(LookupTablesAgreeWithPadList, boost::unit_test::data::xrange(0, 210), i)
+{
+  const MotifType &mt = arrayOfMotifTypes[i];
+  for (int p = 0; p < mt.getNofPads(); ++p) {
+    BOOST_CHECK_EQUAL(mt.padIdByBerg(mt.getBerg(p)), p);
+    BOOST_CHECK_EQUAL(mt.padIdByIndices(mt.getIx(p), mt.getIy(p)), p);
+  }
+  int nofBergs{0};
+  for (int berg = 0; berg <= MotifType::MaxBerg; ++berg) {
+    nofBergs += mt.hasPadByBerg(berg);
+  }
+  BOOST_CHECK_EQUAL(nofBergs, mt.getNofPads());
+}
+
 BOOST_FIXTURE_TEST_SUITE(PadBy, MT)
 
 BOOST_AUTO_TEST_CASE(PadIdByValidBerg)
@@ -0,0 +1,88 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/monomorphic/generators/xrange.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "segmentationFactory.h"
+
+using namespace o2::mch::mapping::impl1;
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(pad_by_position)
+
+BOOST_DATA_TEST_CASE(PadCenterGivesBackThePad, boost::unit_test::data::xrange(0, 21), segtype)
+{
+  for (auto bending: {true, false}) {
+    auto seg = getSegmentationByType(segtype, bending);
+    int nofPads{0};
+    int nofErrors{0};
+    for (auto i = 0; i < seg->nofDualSampas(); ++i) {
+      for (auto ph: seg->getPads(seg->getSampaId(i))) {
+        double x, y;
+        seg->getPadPosition(ph, x, y);
+        if (seg->findPadByPosition(x, y) != ph) {
+          ++nofErrors;
+        }
+        ++nofPads;
+      }
+    }
+    BOOST_TEST(nofPads == seg->nofPads());
+    BOOST_TEST(nofErrors == 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PositionOutsideOfTheSegmentationGivesNoPad)
+{
+  auto seg = getSegmentationByType(2, true);
+  BOOST_TEST(seg->findPadByPosition(1E5, 1E5) == -1);
+  BOOST_TEST(seg->findPadByPosition(-1E5, 0.0) == -1);
+}
+
+BOOST_AUTO_TEST_CASE(FoundPadContainsThePosition)
+{
+  auto seg = getSegmentationByType(0, false);
+  for (double x = -10.0; x < 100.0; x += 1.37) {
+    for (double y = -10.0; y < 100.0; y += 1.37) {
+      int ph = seg->findPadByPosition(x, y);
+      if (ph < 0) {
+        continue;
+      }
+      double px, py, dx, dy;
+      seg->getPadPosition(ph, px, py);
+      seg->getPadDimension(ph, dx, dy);
+      BOOST_TEST(std::abs(x - px) <= dx / 2.0);
+      BOOST_TEST(std::abs(y - py) <= dy / 2.0);
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(HasPadByPositionAgreesWithFindPadByPosition, boost::unit_test::data::xrange(0, 21), segtype)
+{
+  for (auto bending: {true, false}) {
+    auto seg = getSegmentationByType(segtype, bending);
+    int nofDisagreements{0};
+    for (double x = -130.0; x < 130.0; x += 0.73) {
+      for (double y = -30.0; y < 100.0; y += 0.73) {
+        nofDisagreements += seg->hasPadByPosition(x, y) != (seg->findPadByPosition(x, y) >= 0);
+      }
+    }
+    BOOST_TEST(nofDisagreements == 0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/monomorphic/generators/xrange.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "detectionElementCatalogue.h"
+#include "segmentationFactory.h"
+#include <stdexcept>
+#include <vector>
+
+using namespace o2::mch::mapping::impl1;
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(visit_segmentation)
+
+BOOST_AUTO_TEST_CASE(VisitThrowsForInvalidDetElemIdOrSegType)
+{
+  auto id = [](const auto &seg) { return seg.getId(); };
+  BOOST_CHECK_THROW(visit(104, true, id), std::runtime_error);
+  BOOST_CHECK_THROW(visitByType(-1, true, id), std::out_of_range);
+  BOOST_CHECK_THROW(visitByType(21, false, id), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(VisitGivesTheSegmentationOfTheDetectionElement)
+{
+  for (const auto &de: detectionElements) {
+    for (auto bending: {true, false}) {
+      auto nofPads = visit(de.detElemId, bending, [&](const auto &seg) {
+        BOOST_TEST(seg.getId() == de.segType);
+        BOOST_TEST(seg.isBendingPlane() == bending);
+        return seg.nofPads();
+      });
+      BOOST_TEST(nofPads == (bending ? de.nofBendingPads : de.nofNonBendingPads));
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(ForEachPadGivesTheSamePadsAsTheInterface, boost::unit_test::data::xrange(0, 21), segtype)
+{
+  for (auto bending: {true, false}) {
+    auto seg = getSegmentationByType(segtype, bending);
+    std::vector<int> expected;
+    for (auto i = 0; i < seg->nofDualSampas(); ++i) {
+      for (auto ph: seg->getPads(seg->getSampaId(i))) {
+        expected.push_back(ph);
+      }
+    }
+    int nofErrors = visitByType(segtype, bending, [&](const auto &s) {
+      std::vector<int> pads;
+      int n{0};
+      s.forEachPad([&](int ph) {
+        pads.push_back(ph);
+        double x, y, dx, dy;
+        int dualSampaId, dualSampaChannel;
+        seg->getPadPosition(ph, x, y);
+        seg->getPadDimension(ph, dx, dy);
+        seg->getPad(ph, dualSampaId, dualSampaChannel);
+        if (s.padPositionX(ph) != x || s.padPositionY(ph) != y || s.padDimensionX(ph) != dx ||
+            s.padDimensionY(ph) != dy || s.padDualSampaId(ph) != dualSampaId ||
+            s.padDualSampaChannel(ph) != dualSampaChannel) {
+          ++n;
+        }
+      });
+      BOOST_TEST(pads == expected);
+      return n;
+    });
+    BOOST_TEST(nofErrors == 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ForEachPadOfDualSampaGivesTheSamePadsAsGetPads)
+{
+  visit(501, false, [](const auto &seg) {
+    for (auto i = 0; i < seg.nofDualSampas(); ++i) {
+      std::vector<int> pads;
+      seg.forEachPadOfDualSampa(seg.getSampaId(i), [&pads](int ph) { pads.push_back(ph); });
+      BOOST_TEST(pads == seg.getPads(seg.getSampaId(i)));
+    }
+  });
+}
+
+BOOST_AUTO_TEST_CASE(ForEachPadOfUnknownDualSampaGivesNoPad)
+{
+  int n{0};
+  visitByType(5, false, [&n](const auto &seg) {
+    for (auto dualSampaId: {-1, 0, 1024, 1028, 5000}) {
+      seg.forEachPadOfDualSampa(dualSampaId, [&n](int) { ++n; });
+    }
+  });
+  BOOST_TEST(n == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,7 @@
 #define O2_MCH_MAPPING_IMPL1_ZONE_H
 
 #include "contour.h"
+#include "memoryUsage.h"
 #include <vector>
 #include <ostream>
 
@@ -48,6 +49,20 @@ struct Zone
       return false;
     }
 
+    /// Return the number of bytes owned by this zone (excluding its sizeof)
+    std::size_t heapMemoryUsage() const
+    {
+      using o2::mch::mapping::heapMemoryUsage;
+      std::size_t n = heapMemoryUsage(envelop) + heapMemoryUsage(contours) + heapMemoryUsage(motifPositions);
+      for (const auto &c: contours) {
+        n += heapMemoryUsage(c);
+      }
+      for (const auto &mp: motifPositions) {
+        n += mp.heapMemoryUsage();
+      }
+      return n;
+    }
+
     o2::mch::contour::Contour<double> envelop;
     std::vector<o2::mch::contour::Contour<double>> contours;
     std::vector<MOTIFPOSITION> motifPositions;
@@ -0,0 +1,151 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#include "chamberLocator.h"
+#include "detectionElementCatalogue.h"
+#include "segmentationCreator.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace o2 {
+namespace mch {
+namespace mapping {
+namespace impl2 {
+
+namespace {
+
+using BBox = Segmentation::BBox;
+
+constexpr double DegreesToRadians{3.14159265358979323846 / 180.0};
+
+std::vector<const Segmentation *> getSegmentations(const std::vector<DetectionElementPlacement> &placements,
+                                                   bool isBendingPlane)
+{
+  std::vector<const Segmentation *> segmentations;
+  for (auto &p: placements) {
+    int segType = detElemId2SegType(p.detElemId);
+    if (segType < 0) {
+      throw std::out_of_range("detection element " + std::to_string(p.detElemId) + " does not exist");
+    }
+    segmentations.push_back(&getSegmentation(segType, isBendingPlane));
+  }
+  return segmentations;
+}
+
+std::vector<double> cosines(const std::vector<DetectionElementPlacement> &placements)
+{
+  std::vector<double> v;
+  for (auto &p: placements) {
+    v.push_back(std::cos(p.angle * DegreesToRadians));
+  }
+  return v;
+}
+
+std::vector<double> sines(const std::vector<DetectionElementPlacement> &placements)
+{
+  std::vector<double> v;
+  for (auto &p: placements) {
+    v.push_back(std::sin(p.angle * DegreesToRadians));
+  }
+  return v;
+}
+
+/// Return the bounding box, in the chamber frame, of the
+/// (local) box b of a detection element
+BBox toChamber(const BBox &b, const DetectionElementPlacement &p, double cosa, double sina)
+{
+  double xmin{std::numeric_limits<double>::max()};
+  double ymin{std::numeric_limits<double>::max()};
+  double xmax{std::numeric_limits<double>::lowest()};
+  double ymax{std::numeric_limits<double>::lowest()};
+  for (auto x: {b.xmin(), b.xmax()}) {
+    for (auto y: {b.ymin(), b.ymax()}) {
+      double xm = p.mirrored ? -x : x;
+      double xc = p.x0 + cosa * xm - sina * y;
+      double yc = p.y0 + sina * xm + cosa * y;
+      xmin = std::min(xmin, xc);
+      xmax = std::max(xmax, xc);
+      ymin = std::min(ymin, yc);
+      ymax = std::max(ymax, yc);
+    }
+  }
+  return {xmin, ymin, xmax, ymax};
+}
+
+std::vector<BBox> computeEnvelopes(const std::vector<DetectionElementPlacement> &placements,
+                                   const std::vector<const Segmentation *> &bending,
+                                   const std::vector<const Segmentation *> &nonBending,
+                                   const std::vector<double> &cosa, const std::vector<double> &sina)
+{
+  std::vector<BBox> envelopes;
+  for (auto i = 0; i < placements.size(); ++i) {
+    auto b = toChamber(bending[i]->bbox(), placements[i], cosa[i], sina[i]);
+    auto nb = toChamber(nonBending[i]->bbox(), placements[i], cosa[i], sina[i]);
+    envelopes.emplace_back(std::min(b.xmin(), nb.xmin()), std::min(b.ymin(), nb.ymin()),
+                           std::max(b.xmax(), nb.xmax()), std::max(b.ymax(), nb.ymax()));
+  }
+  return envelopes;
+}
+}
+
+ChamberLocator::ChamberLocator(std::vector<DetectionElementPlacement> placements)
+  :
+  mPlacements{std::move(placements)},
+  mBendingSegmentations{getSegmentations(mPlacements, true)},
+  mNonBendingSegmentations{getSegmentations(mPlacements, false)},
+  mCos{cosines(mPlacements)},
+  mSin{sines(mPlacements)},
+  mEnvelopes{computeEnvelopes(mPlacements, mBendingSegmentations, mNonBendingSegmentations, mCos, mSin)},
+  mGrid{createUniformBoxGrid<double>(mEnvelopes.size(), [this](int i) -> const BBox & { return mEnvelopes[i]; })}
+{
+}
+
+void ChamberLocator::chamberToLocal(int i, double x, double y, double &xl, double &yl) const
+{
+  double dx = x - mPlacements[i].x0;
+  double dy = y - mPlacements[i].y0;
+  xl = mCos[i] * dx + mSin[i] * dy;
+  yl = -mSin[i] * dx + mCos[i] * dy;
+  if (mPlacements[i].mirrored) {
+    xl = -xl;
+  }
+}
+
+ChamberLocator::Location ChamberLocator::findPads(double x, double y) const
+{
+  auto candidates = mGrid.candidates(x, y);
+  for (auto it = candidates.first; it != candidates.second; ++it) {
+    int i = *it;
+    const BBox &e = mEnvelopes[i];
+    if (x < e.xmin() || x > e.xmax() || y < e.ymin() || y > e.ymax()) {
+      continue;
+    }
+    double xl, yl;
+    chamberToLocal(i, x, y, xl, yl);
+    int b = mBendingSegmentations[i]->findPadByPosition(xl, yl);
+    int nb = mNonBendingSegmentations[i]->findPadByPosition(xl, yl);
+    if (b != Segmentation::InvalidPadUid || nb != Segmentation::InvalidPadUid) {
+      return {mPlacements[i].detElemId, b, nb};
+    }
+  }
+  return {-1, Segmentation::InvalidPadUid, Segmentation::InvalidPadUid};
+}
+
+}
+}
+}
+}
@@ -0,0 +1,97 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+
+#ifndef O2_MCH_MAPPING_IMPL2_CHAMBERLOCATOR_H
+#define O2_MCH_MAPPING_IMPL2_CHAMBERLOCATOR_H
+
+#include "boxGrid.h"
+#include "segmentationImpl2.h"
+#include <vector>
+
+namespace o2 {
+namespace mch {
+namespace mapping {
+namespace impl2 {
+
+/// Position of a detection element within its chamber plane.
+///
+/// A point (x,y) of the detection element (local) frame is at
+/// R(angle) * (mirrored ? (-x,y) : (x,y)) + (x0,y0) in the chamber plane,
+/// R(angle) being the rotation of angle degrees around the beam axis.
+/// A mirrored detection element is one turned upside down (i.e. rotated
+/// by 180 degrees around the vertical axis), as on one side of the chambers.
+struct DetectionElementPlacement
+{
+    int detElemId;
+    double x0;
+    double y0;
+    double angle;
+    bool mirrored;
+};
+
+/// Locate chamber plane positions within a set of detection elements
+/// (typically the ones of a chamber).
+///
+/// The detection elements envelopes (their bounding boxes, in the chamber
+/// frame) are indexed with a coarse uniform grid, so a lookup only
+/// considers the one or two detection elements around the position,
+/// instead of looping over all of them.
+class ChamberLocator
+{
+  public:
+    struct Location
+    {
+        int detElemId; ///< -1 if no detection element has a pad at the position, on either cathode
+        int bendingPadUid; ///< may be InvalidPadUid, but not both pad uids if detElemId is not -1
+        int nonBendingPadUid; ///< may be InvalidPadUid, but not both pad uids if detElemId is not -1
+    };
+
+    /// Throws std::out_of_range if one of the detection elements is unknown
+    explicit ChamberLocator(std::vector<DetectionElementPlacement> placements);
+
+    /// Return the detection element having a pad at (x,y) (in the chamber
+    /// frame) on at least one of its cathodes, along with the pads at that
+    /// position on its two cathodes. A position in a gap between detection
+    /// elements, or within the envelope of one but without pad on both
+    /// cathodes, gives detElemId = -1.
+    ///
+    /// Where detection elements overlap, the first one (in the order of the
+    /// placements) having a pad at (x,y) on either cathode is returned.
+    Location findPads(double x, double y) const;
+
+    int nofDetectionElements() const
+    { return mPlacements.size(); }
+
+  private:
+    /// Convert (x,y) from the chamber frame to the frame of
+    /// the detection element at index i
+    void chamberToLocal(int i, double x, double y, double &xl, double &yl) const;
+
+  private:
+    std::vector<DetectionElementPlacement> mPlacements;
+    std::vector<const Segmentation *> mBendingSegmentations; // indexed as mPlacements
+    std::vector<const Segmentation *> mNonBendingSegmentations; // indexed as mPlacements
+    std::vector<double> mCos; // indexed as mPlacements
+    std::vector<double> mSin; // indexed as mPlacements
+    std::vector<Segmentation::BBox> mEnvelopes; // indexed as mPlacements
+    o2::mch::mapping::BoxGrid<o2::mch::mapping::UniformAxis<double>> mGrid;
+};
+
+}
+}
+}
+}
+
+#endif
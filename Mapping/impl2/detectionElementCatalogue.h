@@ -0,0 +1,43 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#ifndef O2_MCH_MAPPING_IMPL2_DETECTIONELEMENTCATALOGUE_H
+#define O2_MCH_MAPPING_IMPL2_DETECTIONELEMENTCATALOGUE_H
+
+#include "genDetectionElementCatalogue.h"
+
+namespace o2 {
+namespace mch {
+namespace mapping {
+namespace impl2 {
+
+// the detection element catalogue does not depend on the implementation :
+// it is generated once (in o2::mch::mapping) and only aliased here
+using o2::mch::mapping::DetectionElementInfo;
+using o2::mch::mapping::NofDetectionElements;
+using o2::mch::mapping::NofSegTypes;
+using o2::mch::mapping::NofChambers;
+using o2::mch::mapping::MaxNofDetectionElementsPerChamber;
+using o2::mch::mapping::detectionElements;
+using o2::mch::mapping::detElemIdToDetElemIndex;
+using o2::mch::mapping::segType2DetElemId;
+using o2::mch::mapping::detElemIndex;
+using o2::mch::mapping::detElemId2SegType;
+
+}
+}
+}
+}
+
+#endif
@@ -1,21 +0,0 @@
-#ifndef O2_MCH_MAPPING_GENDETELEMID2SEGTYPE_H
-#define O2_MCH_MAPPING_GENDETELEMID2SEGTYPE_H
-
-//
-// This file has been generated. Do not modify it by hand or your changes might be lost.
-//
-// This implementation file cannot be used standalone, i.e. it is intended to be included
-// into another implementation file.
-//
-
-namespace o2 {
-namespace mch {
-namespace mapping {
-namespace impl2 {
-int detElemId2SegType(int detElemId);
-} // namespace impl2
-} // namespace mapping
-} // namespace mch
-} // namespace o2
-
-#endif // O2_MCH_MAPPING_GENDETELEMID2SEGTYPE_H
\ No newline at end of file
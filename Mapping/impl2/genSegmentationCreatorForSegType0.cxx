@@ -287,7 +287,8 @@ Segmentation* createSegType0(bool isBendingPlane)
       { { 0.6299999952, 0.4199999869 },
         { 0.8399999738, 0.4199999869 },
         { 1.25999999, 0.4199999869 },
-        { 2.519999981, 0.4199999869 } }
+        { 2.519999981, 0.4199999869 } },
+      PadGroupLookup::Grid
     };
   } else {
     return new Segmentation{
@@ -469,7 +470,8 @@ Segmentation* createSegType0(bool isBendingPlane)
       { { 0.6299999952, 0.4199999869 },
         { 0.6299999952, 0.8399999738 },
         { 0.6299999952, 1.679999948 },
-        { 0.6299999952, 3.359999895 } }
+        { 0.6299999952, 3.359999895 } },
+      PadGroupLookup::Grid
     };
   }
 }
@@ -244,7 +244,8 @@ Segmentation* createSegType1(bool isBendingPlane)
                               10, 1,  48, 39, 8,  52, 47, 41, 43, 31, 29, 44, 2,  51, 53, 0,  49, 54, 27, 50, 30, 55,
                               24, 28, 26, 58, 57, 25, 56, 59, 21, 23, 22, 19, 20, 61, 60, 18, 62, 17, 16, 63 } } },
       /* PS */
-      { { 0.75, 0.5 }, { 1.5, 0.5 }, { 3, 0.5 } }
+      { { 0.75, 0.5 }, { 1.5, 0.5 }, { 3, 0.5 } },
+      PadGroupLookup::Grid
     };
   } else {
     return new Segmentation{
@@ -468,7 +469,8 @@ Segmentation* createSegType1(bool isBendingPlane)
                               1,  3,  2,  46, 47, 0,  45, 44, -1, -1, 4,  6,  10, 12, 13, 37, 9,  41, 43, 5,
                               42, 8,  11, 15, 32, 36, 39, 40, -1, -1, 7,  38, 34, 14, 33, 35, -1, -1, -1, -1 } } },
       /* PS */
-      { { 0.75, 0.5 }, { 0.75, 1 }, { 0.75, 2 } }
+      { { 0.75, 0.5 }, { 0.75, 1 }, { 0.75, 2 } },
+      PadGroupLookup::Grid
     };
   }
 }
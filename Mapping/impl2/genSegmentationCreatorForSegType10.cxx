@@ -95,7 +95,8 @@ Segmentation* createSegType10(bool isBendingPlane)
                             -1, -1, 59, -1, -1, 60, -1, -1, 61, -1, -1, 62, -1, -1, 63, -1, 47, 32, -1, 46,
                             33, -1, 45, 34, -1, 44, 35, -1, 43, 36, -1, 42, 37, -1, 41, 38, -1, 40, 39, -1 } } },
       /* PS */
-      { { 2.5, 0.5 }, { 5, 0.5 }, { 10, 0.5 } }
+      { { 2.5, 0.5 }, { 5, 0.5 }, { 10, 0.5 } },
+      PadGroupLookup::Cuts
     };
   } else {
     return new Segmentation{
@@ -212,7 +213,8 @@ Segmentation* createSegType10(bool isBendingPlane)
                             50, 55, 60, 33, 38, 43, -1, -1, 0,  4,  8,  12, 16, 20, 24, 28, 49, 54, 59, 32,
                             37, 42, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 48, 53, 58, 63, 36, 41, 46, 47 } } },
       /* PS */
-      { { 0.7142857313, 2.5 }, { 0.7142857313, 5 }, { 0.7142857313, 10 } }
+      { { 0.7142857313, 2.5 }, { 0.7142857313, 5 }, { 0.7142857313, 10 } },
+      PadGroupLookup::Cuts
     };
   }
 }
@@ -188,7 +188,8 @@ Segmentation* createSegType11(bool isBendingPlane)
         /* E14 */ { 1, 2, { 1, 0 } },
         /* E15 */ { 2, 3, { -1, 1, 0, 2, -1, 3 } } },
       /* PS */
-      { { 2.5, 0.5 }, { 5, 0.5 }, { 10, 0.5 } }
+      { { 2.5, 0.5 }, { 5, 0.5 }, { 10, 0.5 } },
+      PadGroupLookup::Cuts
     };
   } else {
     return new Segmentation{
@@ -349,7 +350,8 @@ Segmentation* createSegType11(bool isBendingPlane)
                             50, 55, 60, 33, 38, 43, -1, -1, 0,  4,  8,  12, 16, 20, 24, 28, 49, 54, 59, 32,
                             37, 42, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 48, 53, 58, 63, 36, 41, 46, 47 } } },
       /* PS */
-      { { 0.7142857313, 2.5 }, { 0.7142857313, 5 }, { 0.7142857313, 10 } }
+      { { 0.7142857313, 2.5 }, { 0.7142857313, 5 }, { 0.7142857313, 10 } },
+      PadGroupLookup::Cuts
     };
   }
 }
@@ -99,7 +99,8 @@ Segmentation* createSegType12(bool isBendingPlane)
                             -1, -1, 59, -1, -1, 60, -1, -1, 61, -1, -1, 62, -1, -1, 63, -1, 47, 32, -1, 46,
                             33, -1, 45, 34, -1, 44, 35, -1, 43, 36, -1, 42, 37, -1, 41, 38, -1, 40, 39, -1 } } },
       /* PS */
-      { { 2.5, 0.5 }, { 5, 0.5 }, { 10, 0.5 } }
+      { { 2.5, 0.5 }, { 5, 0.5 }, { 10, 0.5 } },
+      PadGroupLookup::Cuts
     };
   } else {
     return new Segmentation{
@@ -199,7 +200,8 @@ Segmentation* createSegType12(bool isBendingPlane)
                             23, 18, 13, 9,  5,  1,  46, 42, 38, 33, 60, 55, 50, 29, 24, 19, 14, 10,
                             6,  2,  47, 43, 39, 34, 61, 56, 51, 30, 25, 20, 15, 11, 7,  3 } } },
       /* PS */
-      { { 0.7142857313, 2.5 }, { 0.7142857313, 5 }, { 0.7142857313, 10 } }
+      { { 0.7142857313, 2.5 }, { 0.7142857313, 5 }, { 0.7142857313, 10 } },
+      PadGroupLookup::Cuts
     };
   }
 }
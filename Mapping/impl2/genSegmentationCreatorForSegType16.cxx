@@ -46,7 +46,8 @@ Segmentation* createSegType16(bool isBendingPlane)
                              36, 11, 35, 12, 34, 13, 33, 14, 32, 15, 63, 16, 62, 17, 61, 18, 60, 19, 59, 20, 58, 21,
                              57, 22, 56, 23, 55, 24, 54, 25, 53, 26, 52, 27, 51, 28, 50, 29, 49, 30, 48, 31 } } },
       /* PS */
-      { { 10, 0.5 } }
+      { { 10, 0.5 } },
+      PadGroupLookup::Cuts
     };
   } else {
     return new Segmentation{
@@ -75,7 +76,8 @@ Segmentation* createSegType16(bool isBendingPlane)
                             62, 32, 34, 36, 38, 40, 42, 44, 46, 9,  11, 13, 15, 17, 19, 21, 23, 25, 27,
                             29, 31, 49, 51, 53, 55, 57, 59, 61, 63, 33, 35, 37, 39, 41, 43, 45, 47 } } },
       /* PS */
-      { { 0.7142857313, 10 } }
+      { { 0.7142857313, 10 } },
+      PadGroupLookup::Cuts
     };
   }
 }
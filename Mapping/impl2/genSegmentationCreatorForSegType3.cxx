@@ -164,7 +164,8 @@ Segmentation* createSegType3(bool isBendingPlane)
                             -1, 3,  28, -1, 4,  27, -1, 5,  26, -1, 6,  25, -1, 7,  24, -1, 8,  23, -1, 9,
                             22, -1, 10, 21, -1, 11, 20, -1, 12, 19, -1, 13, 18, -1, 14, 17, -1, 15, 16, -1 } } },
       /* PS */
-      { { 2.5, 0.5 }, { 5, 0.5 } }
+      { { 2.5, 0.5 }, { 5, 0.5 } },
+      PadGroupLookup::Cuts
     };
   } else {
     return new Segmentation{
@@ -281,7 +282,8 @@ Segmentation* createSegType3(bool isBendingPlane)
                             50, 55, 60, 33, 38, 43, -1, -1, 0,  4,  8,  12, 16, 20, 24, 28, 49, 54, 59, 32,
                             37, 42, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 48, 53, 58, 63, 36, 41, 46, 47 } } },
       /* PS */
-      { { 0.7142857313, 2.5 }, { 0.7142857313, 5 } }
+      { { 0.7142857313, 2.5 }, { 0.7142857313, 5 } },
+      PadGroupLookup::Cuts
     };
   }
 }
@@ -0,0 +1,123 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+
+#ifndef O2_MCH_MAPPING_IMPL2_PADARRAY_H
+#define O2_MCH_MAPPING_IMPL2_PADARRAY_H
+
+#include "segmentationImpl2.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <gsl/gsl>
+
+namespace o2 {
+namespace mch {
+namespace mapping {
+namespace impl2 {
+
+/// A container of one T per pad of a segmentation (e.g. charges,
+/// occupancies or calibration constants), indexed by paduid.
+///
+/// The paduids being dense, the storage is exactly nofPads() contiguous
+/// values, in paduid order, which is also the order of the pad groups
+/// (and of the pads within each pad group) in the segmentation.
+template<typename T>
+class PadArray
+{
+    static_assert(!std::is_same<T, bool>::value, "std::vector<bool> is not contiguous, use PadArray<char> instead");
+
+  public:
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    template<typename U>
+    explicit PadArray(const SegmentationT<U> &seg, const T &value = T{}) : mValues(seg.nofPads(), value)
+    {}
+
+    int size() const
+    { return mValues.size(); }
+
+    T &operator[](int paduid)
+    { return mValues[paduid]; }
+
+    const T &operator[](int paduid) const
+    { return mValues[paduid]; }
+
+    /// Same as operator[] but throws std::out_of_range for an invalid paduid
+    T &at(int paduid)
+    {
+      checkRange(paduid);
+      return mValues[paduid];
+    }
+
+    const T &at(int paduid) const
+    {
+      checkRange(paduid);
+      return mValues[paduid];
+    }
+
+    /// Set all the values to value (T{} by default), e.g. to reset
+    /// a per-event buffer
+    void fill(const T &value = T{})
+    { std::fill(mValues.begin(), mValues.end(), value); }
+
+    gsl::span<T> values()
+    { return mValues; }
+
+    gsl::span<const T> values() const
+    { return mValues; }
+
+    iterator begin()
+    { return mValues.begin(); }
+
+    iterator end()
+    { return mValues.end(); }
+
+    const_iterator begin() const
+    { return mValues.begin(); }
+
+    const_iterator end() const
+    { return mValues.end(); }
+
+    /// Call func(paduid,value) for each pad, in paduid order
+    template<typename CALLABLE>
+    void forEach(CALLABLE &&func) const
+    {
+      for (auto paduid = 0; paduid < mValues.size(); ++paduid) {
+        func(paduid, mValues[paduid]);
+      }
+    }
+
+  private:
+    void checkRange(int paduid) const
+    {
+      if (paduid < 0 || paduid >= size()) {
+        throw std::out_of_range("paduid " + std::to_string(paduid) + " should be between 0 and " +
+                                std::to_string(size() - 1));
+      }
+    }
+
+  private:
+    std::vector<T> mValues;
+};
+
+}
+}
+}
+}
+
+#endif
@@ -18,6 +18,7 @@
 #include <stdexcept>
 #include <iostream>
 #include <algorithm>
+#include <string>
 
 namespace o2 {
 namespace mch {
@@ -43,27 +44,55 @@ std::vector<int> validIndices(const std::vector<int>& ids)
   return v;
 }
 
-PadGroupType::PadGroupType(int nofPadsX, int nofPadsY, std::vector<int> ids)
-  :
-  mFastId{std::move(ids)},
-  mFastIndices{validIndices(mFastId)},
-  mNofPads{static_cast<int>(std::count_if(begin(mFastId), end(mFastId), [](int i) { return i >= 0; }))},
-  mNofPadsX{nofPadsX},
-  mNofPadsY{nofPadsY}
+std::vector<int> padIndices(const std::vector<int> &ids)
 {
+  std::vector<int> v(ids.size(), -1);
+  int n{0};
+  for (auto i = 0; i < ids.size(); i++) {
+    if (ids[i] >= 0) {
+      v[i] = n++;
+    }
+  }
+  return v;
 }
 
-int PadGroupType::id(int index) const
+std::vector<uint64_t> occupancy(const std::vector<int> &ids)
 {
-  if (index >= 0 && index < mFastId.size()) {
-    return mFastId[index];
+  std::vector<uint64_t> v((ids.size() + 63) / 64, 0);
+  for (auto i = 0; i < ids.size(); i++) {
+    if (ids[i] >= 0) {
+      v[i / 64] |= uint64_t{1} << (i % 64);
+    }
   }
-  return -1;
+  return v;
 }
 
-bool PadGroupType::hasPadById(int id) const
+std::vector<int> fastIndicesById(const std::vector<int> &ids)
 {
-  return id != -1 && std::find(begin(mFastId), end(mFastId), id) != end(mFastId);
+  std::vector<int> v(ids.empty() ? 0 : *std::max_element(begin(ids), end(ids)) + 1, -1);
+  for (auto i = 0; i < ids.size(); i++) {
+    if (ids[i] >= 0 && v[ids[i]] < 0) {
+      v[ids[i]] = i;
+    }
+  }
+  return v;
+}
+
+PadGroupType::PadGroupType(int nofPadsX, int nofPadsY, std::vector<int> ids)
+  :
+  mFastId{std::move(ids)},
+  mFastIndices{validIndices(mFastId)},
+  mPadIndices{padIndices(mFastId)},
+  mOccupancy{occupancy(mFastId)},
+  mFastIndexById{fastIndicesById(mFastId)},
+  mNofPads{static_cast<int>(mFastIndices.size())},
+  mNofPadsX{nofPadsX},
+  mNofPadsY{nofPadsY}
+{
+  if (mFastId.size() != mNofPadsX * mNofPadsY) {
+    throw std::invalid_argument("pad group type has " + std::to_string(mFastId.size()) + " ids instead of " +
+                                std::to_string(mNofPadsX * mNofPadsY));
+  }
 }
 
 void dump(std::ostream &os, std::string msg, const std::vector<int> &v)
@@ -82,40 +111,6 @@ std::ostream &operator<<(std::ostream &os, const PadGroupType &pgt)
   return os;
 }
 
-std::vector<o2::mch::contour::Polygon<double>> computePads(const PadGroupType &pgt, double padSizeX, double padSizeY)
-{
-  constexpr double EXTRAPADSIZE = 1E-4; // artificially increase size of pads by a smidge (1 micron) to avoid gaps
-  // between pads
-
-  std::vector<o2::mch::contour::Polygon<double>> pads;
-
-  for (int ix = 0; ix < pgt.getNofPadsX(); ++ix) {
-    for (int iy = 0; iy < pgt.getNofPadsY(); ++iy) {
-      if (pgt.id(ix, iy) >= 0) {
-
-        double xmin = ix * padSizeX;
-        double ymin = iy * padSizeY;
-        double xmax = xmin + padSizeX;
-        double ymax = ymin + padSizeY;
-
-        // grow a bit to avoid gaps
-        xmin -= EXTRAPADSIZE;
-        ymin -= EXTRAPADSIZE;
-        xmax += EXTRAPADSIZE;
-        ymax += EXTRAPADSIZE;
-
-        pads.emplace_back(o2::mch::contour::Polygon<double>({{xmin, ymin},
-                                                             {xmax, ymin},
-                                                             {xmax, ymax},
-                                                             {xmin, ymax},
-                                                             {xmin, ymin}})
-        );
-      }
-    }
-  }
-  return pads;
-}
-
 }
 }
 }
@@ -16,8 +16,11 @@
 #ifndef O2_MCH_MAPPING_PADGROUPTYPE_H
 #define O2_MCH_MAPPING_PADGROUPTYPE_H
 
+#include <cstdint>
 #include <vector>
 #include <ostream>
+#include <gsl/gsl>
+#include "memoryUsage.h"
 #include "polygon.h"
 
 namespace o2 {
@@ -47,7 +50,10 @@ struct PadGroupType
       return ix + iy * mNofPadsX;
     }
 
-    int id(int fastIndex) const;
+    int id(int fastIndex) const
+    {
+      return hasPad(fastIndex) ? mFastId[fastIndex] : -1;
+    }
 
     /// Return the index of the pad with indices = (ix,iy)
     /// or -1 if not found
@@ -64,19 +70,62 @@ struct PadGroupType
       return fastIndex - iy(fastIndex)*mNofPadsX;
     }
 
-    std::vector<int> fastIndices() const {
+    /// Return the fastIndices of the existing pads, in increasing order
+    gsl::span<const int> fastIndices() const {
       return mFastIndices;
     }
 
+    /// Whether there is a pad at fastIndex (one bit test)
+    bool hasPad(int fastIndex) const
+    {
+      return fastIndex >= 0 && fastIndex < mFastId.size() &&
+             (mOccupancy[fastIndex / 64] >> (fastIndex % 64)) & 1;
+    }
+
+    /// Whether there is a pad at (ix,iy)
+    bool hasPad(int ix, int iy) const
+    {
+      return ix >= 0 && ix < mNofPadsX && iy >= 0 && iy < mNofPadsY && hasPad(fastIndex(ix, iy));
+    }
+
+    /// Return the (first) fastIndex of the pad with given id, or -1 if not found
+    int fastIndexById(int id) const
+    {
+      return id >= 0 && id < mFastIndexById.size() ? mFastIndexById[id] : -1;
+    }
+
+    /// Return the rank of the pad at fastIndex among the existing
+    /// pads of this type (i.e. its position in fastIndices()),
+    /// or -1 if there is no pad there
+    int padIndex(int fastIndex) const
+    {
+      return mPadIndices[fastIndex];
+    }
+
     /// Whether pad with given id exists
-    bool hasPadById(int id) const;
+    bool hasPadById(int id) const
+    {
+      return fastIndexById(id) >= 0;
+    }
 
     friend std::ostream &operator<<(std::ostream &os, const PadGroupType &type);
 
+    /// Return the number of bytes owned by this pad group type
+    /// (excluding its sizeof)
+    std::size_t heapMemoryUsage() const
+    {
+      using o2::mch::mapping::heapMemoryUsage;
+      return heapMemoryUsage(mFastId) + heapMemoryUsage(mFastIndices) + heapMemoryUsage(mPadIndices) +
+             heapMemoryUsage(mOccupancy) + heapMemoryUsage(mFastIndexById);
+    }
+
     int getIndex(int ix, int iy) const;
 
     std::vector<int> mFastId;
     std::vector<int> mFastIndices;
+    std::vector<int> mPadIndices;
+    std::vector<uint64_t> mOccupancy; // one bit per fastIndex
+    std::vector<int> mFastIndexById;
     int mNofPads;
     int mNofPadsX;
     int mNofPadsY;
@@ -84,8 +133,42 @@ struct PadGroupType
 
 PadGroupType getPadGroupType(int i);
 
-
-std::vector<o2::mch::contour::Polygon<double>> computePads(const PadGroupType &pgt, double padSizeX, double padSizeY);
+/// Return the (slightly enlarged) squares of the pads of pgt,
+/// in the pad group coordinate system
+template<typename T>
+std::vector<o2::mch::contour::Polygon<T>> computePads(const PadGroupType &pgt, T padSizeX, T padSizeY)
+{
+  constexpr T EXTRAPADSIZE = 1E-4; // artificially increase size of pads by a smidge (1 micron) to avoid gaps
+  // between pads
+
+  std::vector<o2::mch::contour::Polygon<T>> pads;
+
+  for (int ix = 0; ix < pgt.getNofPadsX(); ++ix) {
+    for (int iy = 0; iy < pgt.getNofPadsY(); ++iy) {
+      if (pgt.id(ix, iy) >= 0) {
+
+        T xmin = ix * padSizeX;
+        T ymin = iy * padSizeY;
+        T xmax = xmin + padSizeX;
+        T ymax = ymin + padSizeY;
+
+        // grow a bit to avoid gaps
+        xmin -= EXTRAPADSIZE;
+        ymin -= EXTRAPADSIZE;
+        xmax += EXTRAPADSIZE;
+        ymax += EXTRAPADSIZE;
+
+        pads.emplace_back(o2::mch::contour::Polygon<T>({{xmin, ymin},
+                                                        {xmax, ymin},
+                                                        {xmax, ymax},
+                                                        {xmin, ymax},
+                                                        {xmin, ymin}})
+        );
+      }
+    }
+  }
+  return pads;
+}
 
 }
 }
@@ -0,0 +1,73 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+/// Small program which prints the memory used by the segmentations,
+/// per segmentation type and plane, and per member for all the
+/// detection elements (both planes).
+///
+/// As the segmentations are shared by all the detection elements of a
+/// given segmentation type, two totals are given : the memory actually used
+/// by the (shared) segmentations, and the one the detection elements would
+/// use if each one had its own segmentations.
+
+#include "boost/format.hpp"
+#include "detectionElementCatalogue.h"
+#include "segmentationCreator.h"
+#include <iostream>
+#include <map>
+
+using namespace o2::mch::mapping;
+using namespace o2::mch::mapping::impl2;
+
+int main()
+{
+  createAllSegmentations();
+
+  std::cout << boost::format("%7s %5s %7s %10s\n") % "segType" % "plane" % "nofPads" % "bytes";
+  std::size_t shared{0};
+  for (auto segType = 0; segType < NofSegTypes; ++segType) {
+    for (auto isBendingPlane: {true, false}) {
+      const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+      auto bytes = totalMemoryUsage(seg.memoryUsage());
+      shared += bytes;
+      std::cout << boost::format("%7d %5s %7d %10d\n") % segType % (isBendingPlane ? "B" : "NB") % seg.nofPads() %
+                   bytes;
+    }
+  }
+
+  MemoryUsage perMember;
+  std::map<std::string, std::size_t> index;
+  for (const auto &de: detectionElements) {
+    for (auto isBendingPlane: {true, false}) {
+      for (auto &m: getSegmentation(de.segType, isBendingPlane).memoryUsage()) {
+        auto it = index.find(m.first);
+        if (it == index.end()) {
+          it = index.emplace(m.first, perMember.size()).first;
+          perMember.emplace_back(m.first, 0);
+        }
+        perMember[it->second].second += m.second;
+      }
+    }
+  }
+
+  std::cout << "\n" << boost::format("%-20s %12s\n") % "member" % "bytes";
+  for (auto &m: perMember) {
+    std::cout << boost::format("%-20s %12d\n") % m.first % m.second;
+  }
+
+  std::cout << "\n" << boost::format("%-48s %12d\n") % "total for the shared segmentations" % shared;
+  std::cout << boost::format("%-48s %12d\n") % "total if each detection element had its own ones" %
+               totalMemoryUsage(perMember);
+  return 0;
+}
@@ -13,31 +13,82 @@
 /// @author  Laurent Aphecetche
 
 #include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
 #include "segmentationCInterface.h"
+#include "segmentationCInterfaceExt.h"
 #include "impl2_export.h"
+#include "detectionElementCatalogue.h"
+#include "segmentationCreator.h"
 #include "segmentationImpl2.h"
 
+namespace {
+
+using o2::mch::mapping::impl2::Segmentation;
+
+/// The per-pad functions below must not throw (nor terminate) for an
+/// invalid paduid, e.g. the InvalidPadUid of a lookup miss : they give
+/// InvalidDouble or InvalidInt instead, as in impl1
+bool isValid(const Segmentation &seg, int paduid)
+{
+  return paduid >= 0 && paduid < seg.nofPads();
+}
+
+constexpr double InvalidDouble{std::numeric_limits<double>::quiet_NaN()};
+constexpr int InvalidInt{-1};
+}
+
 extern "C" {
 
 struct IMPL2_EXPORT MchSegmentation
 {
-    MchSegmentation(o2::mch::mapping::impl2::Segmentation *i) : impl{i}
+    MchSegmentation(const o2::mch::mapping::impl2::Segmentation *i) : impl{i}
     {}
 
-    std::unique_ptr<o2::mch::mapping::impl2::Segmentation> impl;
+    const o2::mch::mapping::impl2::Segmentation *impl;
 };
 
+/// Handles are shared by all the detection elements of a given
+/// segmentation type (and plane), and point to the process-wide
+/// segmentation cache. They are never deleted.
+/// No exception crosses this C boundary : whatever the failure
+/// (e.g. no creator for the segType), a null handle is returned.
 IMPL2_EXPORT MchSegmentationHandle
 mchSegmentationConstruct(int detElemId, bool isBendingPlane)
 {
-  auto seg = o2::mch::mapping::impl2::createSegmentation(detElemId, isBendingPlane);
-  return seg ? new MchSegmentation{seg} : nullptr;
+  static std::mutex mutex;
+  static std::map<std::pair<int, bool>, MchSegmentation> handles;
+
+  try {
+    int segType = o2::mch::mapping::impl2::detElemId2SegType(detElemId);
+    if (o2::mch::mapping::impl2::getSegmentationCreator(segType) == nullptr) {
+      return nullptr;
+    }
+
+    const auto &seg = o2::mch::mapping::impl2::getSegmentation(segType, isBendingPlane);
+
+    // find before emplace, as the latter allocates a node even when
+    // the handle already exists
+    auto key = std::make_pair(segType, isBendingPlane);
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = handles.find(key);
+    if (it == handles.end()) {
+      it = handles.emplace(key, MchSegmentation{&seg}).first;
+    }
+    return &it->second;
+  } catch (...) {
+    return nullptr;
+  }
 }
 
 IMPL2_EXPORT
 void mchSegmentationDestruct(MchSegmentationHandle sh)
 {
-  delete sh;
+  // nothing to do : handles (and segmentations) are shared
+  // and live until the end of the process
 }
 
 IMPL2_EXPORT
@@ -53,25 +104,40 @@ int mchSegmentationFindPadByPosition(MchSegmentationHandle segHandle, double x,
   return segHandle->impl->findPadByPosition(x, y);
 }
 
+IMPL2_EXPORT
+void mchSegmentationFindPadByPositions(MchSegmentationHandle segHandle, int n,
+                                       const double *x, const double *y, int *paduids)
+{
+  if (n <= 0) {
+    return;
+  }
+  segHandle->impl->findPadByPositions({x, n}, {y, n}, {paduids, n});
+}
+
 IMPL2_EXPORT
 int mchSegmentationFindPadByFEE(MchSegmentationHandle segHandle, int dualSampaId, int dualSampaChannel)
 {
   return segHandle->impl->findPadByFEE(dualSampaId, dualSampaChannel);
 }
 
+IMPL2_EXPORT
+void mchSegmentationFindPadByFEEs(MchSegmentationHandle segHandle, int n,
+                                  const int *dualSampaIds, const int *dualSampaChannels, int *paduids)
+{
+  auto &seg = *(segHandle->impl);
+  for (auto i = 0; i < n; ++i) {
+    paduids[i] = seg.findPadByFEE(dualSampaIds[i], dualSampaChannels[i]);
+  }
+}
+
 IMPL2_EXPORT
 void mchSegmentationForEachDetectionElement(MchDetectionElementHandler handler, void *clientData)
 {
-  for (auto detElemId: {
-    100, 101, 102, 103, 200, 201, 202, 203, 300, 301, 302, 303, 400, 401, 402, 403, 500, 501, 502, 503, 504, 505, 506,
-    507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611,
-    612, 613, 614, 615, 616, 617, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716,
-    717, 718, 719, 720, 721, 722, 723, 724, 725, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813,
-    814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910,
-    911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
-    1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025
-  }) {
-    handler(clientData, detElemId);
+  // only the detection elements this library has a segmentation for
+  for (const auto &de: o2::mch::mapping::impl2::detectionElements) {
+    if (o2::mch::mapping::impl2::getSegmentationCreator(de.segType) != nullptr) {
+      handler(clientData, de.detElemId);
+    }
   }
 }
 
@@ -86,10 +152,10 @@ void mchSegmentationForEachDualSampa(MchSegmentationHandle segHandle, MchDualSam
 IMPL2_EXPORT
 void mchSegmentationForOneDetectionElementOfEachSegmentationType(MchDetectionElementHandler handler, void *clientData)
 {
-  for (auto detElemId : {
-    100, 300, 500, 501, 502, 503, 504, 600, 601, 602, 700, 701, 702, 703, 704, 705, 706, 902, 903, 904, 905
-  }) {
-    handler(clientData, detElemId);
+  for (auto segType = 0; segType < o2::mch::mapping::impl2::NofSegTypes; ++segType) {
+    if (o2::mch::mapping::impl2::getSegmentationCreator(segType) != nullptr) {
+      handler(clientData, o2::mch::mapping::impl2::segType2DetElemId[segType]);
+    }
   }
 }
 
@@ -112,38 +178,84 @@ void mchSegmentationForEachPadInDualSampa(MchSegmentationHandle segHandle, int d
 IMPL2_EXPORT
 double mchSegmentationPadPositionX(MchSegmentationHandle segHandle, int paduid)
 {
-  return segHandle->impl->padPositionX(paduid);
+  const auto &seg = *(segHandle->impl);
+  return isValid(seg, paduid) ? seg.padPositionX(paduid) : InvalidDouble;
 }
 
 IMPL2_EXPORT
 double mchSegmentationPadPositionY(MchSegmentationHandle segHandle, int paduid)
 {
-  return segHandle->impl->padPositionY(paduid);
+  const auto &seg = *(segHandle->impl);
+  return isValid(seg, paduid) ? seg.padPositionY(paduid) : InvalidDouble;
 }
 
 IMPL2_EXPORT
 double mchSegmentationPadSizeX(MchSegmentationHandle segHandle, int paduid)
 {
-  return segHandle->impl->padSizeX(paduid);
+  const auto &seg = *(segHandle->impl);
+  return isValid(seg, paduid) ? seg.padSizeX(paduid) : InvalidDouble;
 }
 
 IMPL2_EXPORT
 double mchSegmentationPadSizeY(MchSegmentationHandle segHandle, int paduid)
 {
-  return segHandle->impl->padSizeY(paduid);
+  const auto &seg = *(segHandle->impl);
+  return isValid(seg, paduid) ? seg.padSizeY(paduid) : InvalidDouble;
 }
 
 IMPL2_EXPORT
 int mchSegmentationPadDualSampaId(MchSegmentationHandle segHandle, int paduid)
 {
-  return segHandle->impl->padDualSampaId(paduid);
+  const auto &seg = *(segHandle->impl);
+  return isValid(seg, paduid) ? seg.padDualSampaId(paduid) : InvalidInt;
 }
 
 IMPL2_EXPORT
 int mchSegmentationPadDualSampaChannel(MchSegmentationHandle segHandle, int paduid)
 {
-  return segHandle->impl->padDualSampaChannel(paduid);
+  const auto &seg = *(segHandle->impl);
+  return isValid(seg, paduid) ? seg.padDualSampaChannel(paduid) : InvalidInt;
+}
 
+IMPL2_EXPORT
+void mchSegmentationPadAttributes(MchSegmentationHandle segHandle, int n, const int *paduids,
+                                  double *positionX, double *positionY,
+                                  double *sizeX, double *sizeY,
+                                  int *dualSampaIds, int *dualSampaChannels)
+{
+  // one loop per requested attribute, each one reading a single
+  // column of the pad table
+  auto &seg = *(segHandle->impl);
+  if (positionX) {
+    for (auto i = 0; i < n; ++i) {
+      positionX[i] = isValid(seg, paduids[i]) ? seg.padPositionX(paduids[i]) : InvalidDouble;
+    }
+  }
+  if (positionY) {
+    for (auto i = 0; i < n; ++i) {
+      positionY[i] = isValid(seg, paduids[i]) ? seg.padPositionY(paduids[i]) : InvalidDouble;
+    }
+  }
+  if (sizeX) {
+    for (auto i = 0; i < n; ++i) {
+      sizeX[i] = isValid(seg, paduids[i]) ? seg.padSizeX(paduids[i]) : InvalidDouble;
+    }
+  }
+  if (sizeY) {
+    for (auto i = 0; i < n; ++i) {
+      sizeY[i] = isValid(seg, paduids[i]) ? seg.padSizeY(paduids[i]) : InvalidDouble;
+    }
+  }
+  if (dualSampaIds) {
+    for (auto i = 0; i < n; ++i) {
+      dualSampaIds[i] = isValid(seg, paduids[i]) ? seg.padDualSampaId(paduids[i]) : InvalidInt;
+    }
+  }
+  if (dualSampaChannels) {
+    for (auto i = 0; i < n; ++i) {
+      dualSampaChannels[i] = isValid(seg, paduids[i]) ? seg.padDualSampaChannel(paduids[i]) : InvalidInt;
+    }
+  }
 }
 
 IMPL2_EXPORT
@@ -151,12 +263,8 @@ void
 mchSegmentationForEachPadInArea(MchSegmentationHandle segHandle, double xmin, double ymin, double xmax, double ymax,
                                 MchPadHandler handler, void *clientData)
 {
-  auto &seg = segHandle->impl;
-  o2::mch::mapping::impl2::Segmentation::BBox box{xmin,ymin,xmax,ymax};
-  for (auto p: segHandle->impl->getPadUids(box)) {
-    handler(clientData, p);
-  }
-
+  segHandle->impl->forEachPadInArea(xmin, ymin, xmax, ymax,
+                                    [handler, clientData](int paduid) { handler(clientData, paduid); });
 }
 
 IMPL2_EXPORT
@@ -164,7 +272,19 @@ void
 mchSegmentationForEachNeighbouringPad(MchSegmentationHandle segHandle, int paduid, MchPadHandler handler,
                                       void *userData)
 {
+  for (auto nuid: segHandle->impl->getNeighbours(paduid)) {
+    handler(userData, nuid);
+  }
+}
 
+IMPL2_EXPORT
+void
+mchSegmentationForEachEdgeNeighbouringPad(MchSegmentationHandle segHandle, int paduid, MchPadHandler handler,
+                                          void *userData)
+{
+  for (auto nuid: segHandle->impl->getEdgeNeighbours(paduid)) {
+    handler(userData, nuid);
+  }
 }
 
 } // extern "C"
@@ -12,8 +12,18 @@
 ///
 /// @author  Laurent Aphecetche
 #include "segmentationCreator.h"
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace o2 {
 namespace mch {
@@ -26,8 +36,17 @@ std::map<int, SegmentationCreator>& Creators()
   return creators;
 }
 
+/// Guards the creators and the segmentation cache, which can
+/// both get new entries at any time (e.g. from a library loaded late)
+std::mutex &CreatorsMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
 void registerSegmentationCreator(int segType, SegmentationCreator func)
 {
+  std::lock_guard<std::mutex> lock(CreatorsMutex());
   if (Creators().find(segType)!=Creators().end())
   {
     std::cerr << "WARNING: there is already a creator registered for segType=" << segType
@@ -39,7 +58,95 @@ void registerSegmentationCreator(int segType, SegmentationCreator func)
 
 SegmentationCreator getSegmentationCreator(int segType)
 {
-  return Creators()[segType];
+  std::lock_guard<std::mutex> lock(CreatorsMutex());
+  auto it = Creators().find(segType);
+  return it != Creators().end() ? it->second : nullptr;
+}
+
+namespace {
+
+struct CachedSegmentation
+{
+    std::once_flag created;
+    std::unique_ptr<const Segmentation> segmentation;
+};
+
+using SegmentationCache = std::map<std::pair<int, bool>, CachedSegmentation>;
+
+SegmentationCache &Cache()
+{
+  static SegmentationCache cache;
+  return cache;
+}
+
+/// Return the cache entry of the given segType and plane, adding it if
+/// there is a creator for that segType (so creators registered after the
+/// first call are handled as well), or nullptr if there is none.
+/// The entries are never removed and the map nodes never move, so the
+/// returned entry can be used without holding the lock.
+SegmentationCache::value_type *findCacheEntry(std::pair<int, bool> key)
+{
+  std::lock_guard<std::mutex> lock(CreatorsMutex());
+  auto it = Cache().find(key);
+  if (it == Cache().end()) {
+    if (Creators().find(key.first) == Creators().end()) {
+      return nullptr;
+    }
+    it = Cache().emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple()).first;
+  }
+  return &(*it);
+}
+
+const Segmentation &getCachedSegmentation(SegmentationCache::value_type &entry)
+{
+  std::call_once(entry.second.created, [&entry]() {
+    entry.second.segmentation.reset(getSegmentationCreator(entry.first.first)(entry.first.second));
+  });
+  return *entry.second.segmentation;
+}
+}
+
+const Segmentation &getSegmentation(int segType, bool isBendingPlane)
+{
+  auto entry = findCacheEntry({segType, isBendingPlane});
+  if (!entry) {
+    throw std::out_of_range("no segmentation creator for segType " + std::to_string(segType));
+  }
+  return getCachedSegmentation(*entry);
+}
+
+void createAllSegmentations()
+{
+  std::vector<int> segTypes;
+  {
+    std::lock_guard<std::mutex> lock(CreatorsMutex());
+    for (auto &creator: Creators()) {
+      segTypes.push_back(creator.first);
+    }
+  }
+  std::vector<SegmentationCache::value_type *> entries;
+  for (auto segType: segTypes) {
+    for (auto isBendingPlane: {true, false}) {
+      entries.push_back(findCacheEntry({segType, isBendingPlane}));
+    }
+  }
+
+  std::atomic<int> next{0};
+  auto worker = [&entries, &next]() {
+    for (int i = next++; i < entries.size(); i = next++) {
+      getCachedSegmentation(*entries[i]);
+    }
+  };
+
+  int nofThreads = std::max(1, std::min<int>(std::thread::hardware_concurrency(), entries.size()));
+  std::vector<std::thread> threads;
+  for (auto i = 1; i < nofThreads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &t: threads) {
+    t.join();
+  }
 }
 
 }
@@ -28,6 +28,19 @@ void registerSegmentationCreator(int segType, SegmentationCreator func);
 
 SegmentationCreator getSegmentationCreator(int segType);
 
+/// Return the segmentation of the given type and plane.
+///
+/// The segmentations are immutable and shared : each one is created
+/// once per process, on first use, whatever the number of detection
+/// elements using it. This function is thread-safe, and finds the
+/// creators whenever they are registered (even after its first call).
+/// Throws std::out_of_range if there is no creator for segType.
+const Segmentation &getSegmentation(int segType, bool isBendingPlane);
+
+/// Create (in parallel) all the segmentations that getSegmentation
+/// can return, so that later calls do not pay the construction cost.
+void createAllSegmentations();
+
 }
 }
 }
@@ -14,15 +14,18 @@
 
 #include "segmentationImpl2.h"
 #include "boost/format.hpp"
-#include "genDetElemId2SegType.h"
+#include "detectionElementCatalogue.h"
 #include "padGroup.h"
 #include "padSize.h"
 #include "MCHMappingInterface/Segmentation.h"
 #include "segmentationCreator.h"
 #include "contourCreator.h"
 #include "padGroupType.h"
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <set>
@@ -48,11 +51,12 @@ Segmentation *createSegmentation(int detElemId, bool isBendingPlane)
   return creator(isBendingPlane);
 }
 
-Segmentation::Polygon computePadGroupTypeContour(const PadGroupType &pgt, double padSizeX, double padSizeY)
+template<typename T>
+o2::mch::contour::Polygon<T> computePadGroupTypeContour(const PadGroupType &pgt, T padSizeX, T padSizeY)
 {
-  std::vector<o2::mch::contour::Polygon<double>> pads{computePads(pgt, padSizeX, padSizeY)};
+  std::vector<o2::mch::contour::Polygon<T>> pads{computePads(pgt, padSizeX, padSizeY)};
 
-  o2::mch::contour::Contour<double> contour = o2::mch::contour::createContour(pads);
+  o2::mch::contour::Contour<T> contour = o2::mch::contour::createContour(pads);
   if (contour.size() != 1) {
     std::cout << "OUPS. Contour.size()=" << contour.size() << "\n";
     throw std::runtime_error("contour size should be 1 and is " + std::to_string(contour.size()));
@@ -63,15 +67,16 @@ Segmentation::Polygon computePadGroupTypeContour(const PadGroupType &pgt, double
   return contour[0];
 }
 
-std::vector<Segmentation::Polygon> computeContours(const std::vector<PadGroup> &padGroups,
-                                                   const std::vector<PadGroupType> &padGroupTypes,
-                                                   const std::vector<std::pair<float, float>> &padSizes)
+template<typename T>
+std::vector<o2::mch::contour::Polygon<T>> computeContours(const std::vector<PadGroup> &padGroups,
+                                                          const std::vector<PadGroupType> &padGroupTypes,
+                                                          const std::vector<std::pair<float, float>> &padSizes)
 {
-  std::vector<Segmentation::Polygon> contours;
+  std::vector<o2::mch::contour::Polygon<T>> contours;
 
   for (auto &pg: padGroups) {
-    auto c = computePadGroupTypeContour(padGroupTypes[pg.mPadGroupTypeId], padSizes[pg.mPadSizeId].first,
-                                        padSizes[pg.mPadSizeId].second);
+    auto c = computePadGroupTypeContour<T>(padGroupTypes[pg.mPadGroupTypeId], padSizes[pg.mPadSizeId].first,
+                                           padSizes[pg.mPadSizeId].second);
     c.translate(pg.mX, pg.mY);
     contours.push_back(c);
   }
@@ -89,7 +94,18 @@ std::set<int> getUnique(const std::vector<PadGroup> &padGroups)
   return u;
 }
 
-Segmentation::Polygon computeEnvelop(const std::vector<Segmentation::Polygon> &polygons)
+template<typename T>
+std::vector<o2::mch::contour::BBox<T>> computeBBoxes(const std::vector<o2::mch::contour::Polygon<T>> &polygons)
+{
+  std::vector<o2::mch::contour::BBox<T>> boxes;
+  for (auto &p: polygons) {
+    boxes.push_back(o2::mch::contour::getBBox(p));
+  }
+  return boxes;
+}
+
+template<typename T>
+o2::mch::contour::Polygon<T> computeEnvelop(const std::vector<o2::mch::contour::Polygon<T>> &polygons)
 {
   auto contour = o2::mch::contour::createContour(polygons);
   if (contour.size() != 1) {
@@ -98,9 +114,23 @@ Segmentation::Polygon computeEnvelop(const std::vector<Segmentation::Polygon> &p
   return contour[0];
 }
 
-Segmentation::Segmentation(int segType, bool isBendingPlane, std::vector<PadGroup> padGroups,
-                           std::vector<PadGroupType> padGroupTypes,
-                           std::vector<std::pair<float, float>> padSizes)
+/// Build the pad group index of the given lookup strategy only
+template<typename T>
+PadGroupIndex<T> createPadGroupIndex(PadGroupLookup padGroupLookup,
+                                     const std::vector<o2::mch::contour::BBox<T>> &boxes)
+{
+  auto boxOf = [&boxes](int i) -> const o2::mch::contour::BBox<T> & { return boxes[i]; };
+  if (padGroupLookup == PadGroupLookup::Cuts) {
+    return createCutsBoxGrid<T>(boxes.size(), boxOf);
+  }
+  return createUniformBoxGrid<T>(boxes.size(), boxOf);
+}
+
+template<typename T>
+SegmentationT<T>::SegmentationT(int segType, bool isBendingPlane, std::vector<PadGroup> padGroups,
+                                std::vector<PadGroupType> padGroupTypes,
+                                std::vector<std::pair<float, float>> padSizes,
+                                PadGroupLookup padGroupLookup)
   :
   mSegType{segType},
   mIsBendingPlane{isBendingPlane},
@@ -108,175 +138,472 @@ Segmentation::Segmentation(int segType, bool isBendingPlane, std::vector<PadGrou
   mDualSampaIds{getUnique(mPadGroups)},
   mPadGroupTypes{std::move(padGroupTypes)},
   mPadSizes{std::move(padSizes)},
-  mPadGroupContours{computeContours(mPadGroups, mPadGroupTypes, mPadSizes)},
-  mMaxFastIndex{-1},
+  mPadGroupContours{computeContours<T>(mPadGroups, mPadGroupTypes, mPadSizes)},
+  mPadGroupBBoxes{computeBBoxes(mPadGroupContours)},
   mEnvelop{computeEnvelop(mPadGroupContours)},
-  mBBox{o2::mch::contour::getBBox(mEnvelop)}
+  mBBox{o2::mch::contour::getBBox(mEnvelop)},
+  mPadGroupIndex{createPadGroupIndex(padGroupLookup, mPadGroupBBoxes)}
 {
-  for (auto &pgt: mPadGroupTypes) {
-    for (auto &fi : pgt.fastIndices()) {
-      mMaxFastIndex = std::max(mMaxFastIndex, fi);
+  computePadTable();
+  computeFEETables();
+  computeNeighbours();
+}
+
+/// Build the pad attribute table (structure-of-arrays indexed by paduid),
+/// so getting a pad attribute is a single load instead of decoding
+/// the paduid into its pad group and pad group type.
+template<typename T>
+void SegmentationT<T>::computePadTable()
+{
+  mPadGroupPadOffsets.assign(mPadGroups.size() + 1, 0);
+  for (auto padGroupIndex = 0; padGroupIndex < mPadGroups.size(); ++padGroupIndex) {
+    mPadGroupPadOffsets[padGroupIndex + 1] = mPadGroupPadOffsets[padGroupIndex] +
+                                             mPadGroupTypes[mPadGroups[padGroupIndex].mPadGroupTypeId].getNofPads();
+  }
+
+  const int nofPads{mPadGroupPadOffsets.back()};
+
+  mPadPositionX.resize(nofPads);
+  mPadPositionY.resize(nofPads);
+  mPadSizeX.resize(nofPads);
+  mPadSizeY.resize(nofPads);
+  mPadDualSampaIds.resize(nofPads);
+  mPadDualSampaChannels.resize(nofPads);
+
+  for (auto padGroupIndex = 0; padGroupIndex < mPadGroups.size(); ++padGroupIndex) {
+    auto &pg = mPadGroups[padGroupIndex];
+    auto &pgt = mPadGroupTypes[pg.mPadGroupTypeId];
+    auto &padSize = mPadSizes[pg.mPadSizeId];
+    for (auto fi: pgt.fastIndices()) {
+      int paduid = padUid(padGroupIndex, fi);
+      mPadPositionX[paduid] = pg.mX + (pgt.ix(fi) + 0.5) * padSize.first;
+      mPadPositionY[paduid] = pg.mY + (pgt.iy(fi) + 0.5) * padSize.second;
+      mPadSizeX[paduid] = padSize.first;
+      mPadSizeY[paduid] = padSize.second;
+      mPadDualSampaIds[paduid] = pg.mFECId;
+      mPadDualSampaChannels[paduid] = pgt.id(fi);
     }
   }
-  mMaxFastIndex++;
 }
 
-std::vector<int> Segmentation::findPadGroupIndices(double x, double y) const
+/// Build the dual sampa lookup tables :
+/// - dualSampaId -> dualSampaIndex (position in mDualSampaIds)
+/// - dualSampaIndex -> paduids (compressed sparse row layout)
+/// - dualSampaIndex*NofDualSampaChannels + channel -> paduid
+template<typename T>
+void SegmentationT<T>::computeFEETables()
 {
-  std::vector<int> pgi;
-  for (auto i = 0; i < mPadGroupContours.size(); ++i) {
-    if (mPadGroupContours[i].contains(x, y)) {
-      pgi.push_back(i);
+  const int nofDualSampas{static_cast<int>(mDualSampaIds.size())};
+
+  mDualSampaIndices.assign(mDualSampaIds.empty() ? 0 : *mDualSampaIds.rbegin() + 1, -1);
+  int index{0};
+  for (auto dualSampaId: mDualSampaIds) {
+    mDualSampaIndices[dualSampaId] = index++;
+  }
+
+  std::vector<std::vector<int>> padGroupsPerDualSampa(nofDualSampas);
+  for (auto padGroupIndex = 0; padGroupIndex < mPadGroups.size(); ++padGroupIndex) {
+    padGroupsPerDualSampa[dualSampaIndex(mPadGroups[padGroupIndex].mFECId)].push_back(padGroupIndex);
+  }
+
+  mDualSampaPadOffsets.assign(nofDualSampas + 1, 0);
+  mDualSampaPads.clear();
+  mFEEPadUids.assign(nofDualSampas * NofDualSampaChannels, InvalidPadUid);
+
+  for (auto i = 0; i < nofDualSampas; ++i) {
+    mDualSampaPadOffsets[i] = mDualSampaPads.size();
+    for (auto padGroupIndex: padGroupsPerDualSampa[i]) {
+      auto &pgt = mPadGroupTypes[mPadGroups[padGroupIndex].mPadGroupTypeId];
+      for (auto fi: pgt.fastIndices()) {
+        int channel = pgt.id(fi);
+        if (channel < 0 || channel >= NofDualSampaChannels) {
+          throw std::out_of_range("dual sampa channel " + std::to_string(channel) + " is out of range");
+        }
+        int paduid = padUid(padGroupIndex, fi);
+        mDualSampaPads.push_back(paduid);
+        int &fee = mFEEPadUids[i * NofDualSampaChannels + channel];
+        if (!isValid(fee)) {
+          fee = paduid;
+        }
+      }
     }
   }
-  return pgi;
+  mDualSampaPadOffsets[nofDualSampas] = mDualSampaPads.size();
 }
 
-int Segmentation::padUid(int padGroupIndex, double x, double y) const
+/// Build the neighbour table (in compressed sparse row layout).
+///
+/// Two pads are neighbours if their areas touch (within a 1 micron
+/// tolerance), whatever their pad groups and pad sizes.
+/// For each pad the neighbours sharing an edge are stored first,
+/// followed by the ones touching only by a corner, so both
+/// getNeighbours and getEdgeNeighbours are a mere slice of the table.
+///
+/// The neighbours of a pad are searched with forEachPadInArea, i.e. only
+/// within the few pad groups the grid (or the cuts) gives around it, so
+/// the cost is linear in the number of pads.
+template<typename T>
+void SegmentationT<T>::computeNeighbours()
 {
-  auto &pg = mPadGroups[padGroupIndex];
-  int ix = static_cast<int>(std::floor((x - pg.mX) / mPadSizes[pg.mPadSizeId].first));
-  int iy = static_cast<int>(std::floor((y - pg.mY) / mPadSizes[pg.mPadSizeId].second));
-  auto &pgt = mPadGroupTypes[pg.mPadGroupTypeId];
-  if (pgt.hasPadById(pgt.id(ix, iy))) {
-    return padUid(padGroupIndex, pgt.fastIndex(ix, iy));
+  const T epsilon{1E-4};
+  const int n{nofPads()};
+
+  mNeighbourOffsets.assign(n + 1, 0);
+  mNeighbourEdgeEnds.assign(n, 0);
+  mNeighbours.clear();
+
+  std::vector<int> corners;
+
+  for (auto paduid = 0; paduid < n; ++paduid) {
+    mNeighbourOffsets[paduid] = mNeighbours.size();
+    T dx = padSizeX(paduid) / 2.0;
+    T dy = padSizeY(paduid) / 2.0;
+    BBox pad{padPositionX(paduid) - dx, padPositionY(paduid) - dy,
+             padPositionX(paduid) + dx, padPositionY(paduid) + dy};
+    BBox area{pad.xmin() - epsilon, pad.ymin() - epsilon, pad.xmax() + epsilon, pad.ymax() + epsilon};
+    corners.clear();
+    forEachPadInArea(area, [&](int nuid) {
+      if (nuid == paduid) {
+        return;
+      }
+      T nx = padPositionX(nuid);
+      T ny = padPositionY(nuid);
+      T ndx = padSizeX(nuid) / 2.0;
+      T ndy = padSizeY(nuid) / 2.0;
+      // lengths of the overlaps of the two pads projections
+      T overlapX = std::min(pad.xmax(), nx + ndx) - std::max(pad.xmin(), nx - ndx);
+      T overlapY = std::min(pad.ymax(), ny + ndy) - std::max(pad.ymin(), ny - ndy);
+      if (overlapX > epsilon || overlapY > epsilon) {
+        mNeighbours.push_back(nuid);
+      } else {
+        corners.push_back(nuid);
+      }
+    });
+    mNeighbourEdgeEnds[paduid] = mNeighbours.size();
+    mNeighbours.insert(end(mNeighbours), begin(corners), end(corners));
   }
-  return -1;
+  mNeighbourOffsets[n] = mNeighbours.size();
 }
 
-int Segmentation::findPadByPosition(double x, double y) const
+template<typename T>
+int SegmentationT<T>::padUidByIndices(int padGroupIndex, int ix, int iy) const
 {
-  auto pgis = findPadGroupIndices(x, y);
-  if (pgis.empty()) {
-    return -1;
+  auto &pgt = mPadGroupTypes[mPadGroups[padGroupIndex].mPadGroupTypeId];
+  // (x,y) might be in the (1 micron) margin of the pad group contour,
+  // in which case ix,iy are out of range and would alias another pad,
+  // hence the range check of hasPad(ix,iy)
+  if (pgt.hasPad(ix, iy)) {
+    return padUid(padGroupIndex, pgt.fastIndex(ix, iy));
   }
+  return InvalidPadUid;
+}
+
+template<typename T>
+int SegmentationT<T>::padUid(int padGroupIndex, T x, T y) const
+{
+  // computed with T, as in findPadByPositions, so both give the same pads
+  auto &pg = mPadGroups[padGroupIndex];
+  T fx = (x - static_cast<T>(pg.mX)) / static_cast<T>(mPadSizes[pg.mPadSizeId].first);
+  T fy = (y - static_cast<T>(pg.mY)) / static_cast<T>(mPadSizes[pg.mPadSizeId].second);
+  return padUidByIndices(padGroupIndex, static_cast<int>(std::floor(fx)), static_cast<int>(std::floor(fy)));
+}
+
+template<typename T>
+int SegmentationT<T>::findPadByPosition(T x, T y) const
+{
+  return withPadGroupIndex([this, x, y](const auto &index) { return findPadByPosition(index, x, y); });
+}
 
-  // most probable case : only 1 padgroup found
-  if (pgis.size() == 1) {
-    return padUid(pgis.front(), x, y);
+template<typename T>
+template<typename INDEX>
+int SegmentationT<T>::findPadByPosition(const INDEX &index, T x, T y) const
+{
+  // the grid (or the cuts) gives us the few pad groups which might contain (x,y),
+  // in increasing pad group index order.
+  // the first of those that gives back a valid pad wins.
+  auto candidates = index.candidates(x, y);
+  for (auto it = candidates.first; it != candidates.second; ++it) {
+    int padGroupIndex = *it;
+    const BBox &box = mPadGroupBBoxes[padGroupIndex];
+    if (x < box.xmin() || x > box.xmax() || y < box.ymin() || y > box.ymax()) {
+      continue;
+    }
+    if (!mPadGroupContours[padGroupIndex].contains(x, y)) {
+      continue;
+    }
+    int paduid = padUid(padGroupIndex, x, y);
+    if (isValid(paduid)) {
+      return paduid;
+    }
   }
+  return InvalidPadUid;
+}
 
-  // more than one padgroup : find one
-  // that give back a valid pad
-  double dmin{std::numeric_limits<double>::max()};
-  int rv{-1};
-  o2::mch::contour::Vertex<double> point{x, y};
-
-  for (auto i = 0; i < pgis.size() && rv < 0; ++i) {
-    double d = o2::mch::contour::squaredDistancePointToPolygon(point, mPadGroupContours[pgis[i]]);
-    int p = padUid(pgis[i], x, y);
-    if (p >= 0) {
-      rv = p;
+/// Return the index of the first pad group containing (x,y), or -1 if none.
+/// hasOtherCandidates is set to true if some more pad groups might
+/// contain the point as well.
+template<typename T>
+template<typename INDEX>
+int SegmentationT<T>::firstPadGroupContaining(const INDEX &index, T x, T y, bool &hasOtherCandidates) const
+{
+  auto candidates = index.candidates(x, y);
+  for (auto it = candidates.first; it != candidates.second; ++it) {
+    int padGroupIndex = *it;
+    const BBox &box = mPadGroupBBoxes[padGroupIndex];
+    if (x < box.xmin() || x > box.xmax() || y < box.ymin() || y > box.ymax()) {
+      continue;
+    }
+    if (mPadGroupContours[padGroupIndex].contains(x, y)) {
+      hasOtherCandidates = it + 1 != candidates.second;
+      return padGroupIndex;
     }
   }
+  hasOtherCandidates = false;
+  return -1;
+}
 
-  return rv;
+template<typename T>
+void SegmentationT<T>::findPadByPositions(gsl::span<const T> x, gsl::span<const T> y,
+                                          gsl::span<int> paduids) const
+{
+  if (x.size() != y.size() || x.size() != paduids.size()) {
+    throw std::invalid_argument("x, y and paduids must have the same size");
+  }
+  withPadGroupIndex([&](const auto &index) { findPadByPositions(index, x, y, paduids); });
 }
 
-std::vector<int> Segmentation::getPadUids(int dualSampaId) const
+template<typename T>
+template<typename INDEX>
+void SegmentationT<T>::findPadByPositions(const INDEX &index, gsl::span<const T> x, gsl::span<const T> y,
+                                          gsl::span<int> paduids) const
 {
-  std::vector<int> pi;
 
-  for (auto padGroupIndex = 0; padGroupIndex < mPadGroups.size(); ++padGroupIndex) {
-    if (mPadGroups[padGroupIndex].mFECId == dualSampaId) {
-      auto &pgt = mPadGroupTypes[mPadGroups[padGroupIndex].mPadGroupTypeId];
-      for (auto &fi: pgt.fastIndices()) {
-        pi.push_back(padUid(padGroupIndex, fi));
+  // The points are processed in fixed size batches, using stack arrays only.
+  // The bounding box rejection and the ix,iy computations are simple loops
+  // over structure-of-arrays, that the compiler can vectorize. Only the
+  // pad group search (grid or cuts + polygon) and the final id lookup are scalar.
+  constexpr int BatchSize{64};
+
+  std::array<int, BatchSize> inside;
+  std::array<int, BatchSize> padGroupIndex;
+  std::array<bool, BatchSize> fallback;
+  std::array<T, BatchSize> relativeX; // position relative to the pad group origin
+  std::array<T, BatchSize> relativeY;
+  std::array<T, BatchSize> padSizeX;
+  std::array<T, BatchSize> padSizeY;
+  std::array<int, BatchSize> ix;
+  std::array<int, BatchSize> iy;
+
+  const T xmin{mBBox.xmin()};
+  const T xmax{mBBox.xmax()};
+  const T ymin{mBBox.ymin()};
+  const T ymax{mBBox.ymax()};
+
+  for (auto start = 0; start < x.size(); start += BatchSize) {
+
+    const int n = std::min<int>(BatchSize, x.size() - start);
+    const T *px = x.data() + start;
+    const T *py = y.data() + start;
+    int *puid = paduids.data() + start;
+
+    // vectorizable : bounding box rejection
+    for (auto i = 0; i < n; ++i) {
+      inside[i] = (px[i] >= xmin) & (px[i] <= xmax) & (py[i] >= ymin) & (py[i] <= ymax);
+    }
+
+    // scalar : pad group search for the points that survived
+    for (auto i = 0; i < n; ++i) {
+      padGroupIndex[i] = inside[i] ? firstPadGroupContaining(index, px[i], py[i], fallback[i]) : -1;
+      if (padGroupIndex[i] >= 0) {
+        auto &pg = mPadGroups[padGroupIndex[i]];
+        relativeX[i] = px[i] - static_cast<T>(pg.mX);
+        relativeY[i] = py[i] - static_cast<T>(pg.mY);
+        padSizeX[i] = mPadSizes[pg.mPadSizeId].first;
+        padSizeY[i] = mPadSizes[pg.mPadSizeId].second;
+      } else {
+        // the index arithmetic below is then done on zeros, whatever
+        // the point (far away, infinite or NaN), so the float to int
+        // conversions stay defined
+        fallback[i] = false;
+        relativeX[i] = relativeY[i] = 0.0;
+        padSizeX[i] = padSizeY[i] = 1.0;
       }
     }
-  }
 
-  return pi;
-}
+    // vectorizable : floor/index arithmetic
+    // (the floor is done with a truncation and a correction for negative
+    // values, as std::floor prevents the vectorization unless the
+    // floating point exceptions are ignored, e.g. with -ffast-math)
+    for (auto i = 0; i < n; ++i) {
+      T fx = relativeX[i] / padSizeX[i];
+      T fy = relativeY[i] / padSizeY[i];
+      ix[i] = static_cast<int>(fx);
+      iy[i] = static_cast<int>(fy);
+      ix[i] -= fx < ix[i];
+      iy[i] -= fy < iy[i];
+    }
 
-std::vector<int> Segmentation::uniqueAndValid(std::vector<int> paduids) const
-{
-  std::vector<int> rv;
-  std::sort(begin(paduids), end(paduids));
-  int previous{InvalidPadUid};
-  for (auto i = 0; i < paduids.size(); ++i) {
-    int p = paduids[i];
-    if (p != previous && p != InvalidPadUid) {
-      rv.push_back(p);
-      previous = p;
+    // scalar : pad lookup, and fallback to the point-by-point search
+    // for the (rare) points where pad groups overlap
+    for (auto i = 0; i < n; ++i) {
+      puid[i] = padGroupIndex[i] >= 0 ? padUidByIndices(padGroupIndex[i], ix[i], iy[i]) : InvalidPadUid;
+      if (!isValid(puid[i]) && fallback[i]) {
+        puid[i] = findPadByPosition(index, px[i], py[i]);
+      }
     }
   }
-  return rv;
 }
 
+namespace {
+
+/// Return the square of the distance between (x,y) and the box
+/// (0 if (x,y) is inside the box)
+template<typename T>
+T squaredDistance(T xmin, T ymin, T xmax, T ymax, T x, T y)
+{
+  T dx = std::max({xmin - x, T{0}, x - xmax});
+  T dy = std::max({ymin - y, T{0}, y - ymax});
+  return dx * dx + dy * dy;
+}
 
-void dumpPads(std::string msg, const Segmentation &seg, const std::vector<int> &paduids)
+/// Clip the segment (x,y)->(x+dx,y+dy) with the box (slab method),
+/// i.e. restrict [tmin,tmax] to the part of the segment within the box.
+/// Return false if the segment does not cross the box.
+template<typename T>
+bool clip(T xmin, T ymin, T xmax, T ymax,
+          T x, T y, T dx, T dy, T &tmin, T &tmax)
 {
-  std::cout << msg << "\n";
-  for (auto &paduid: paduids) {
-    std::cout << boost::str(boost::format("Pad %10d FEC %4d CH %2d X %7.3f Y %7.3f SX %7.3f SY %7.3f\n") % paduid
-                            % seg.padDualSampaId(paduid) % seg.padDualSampaChannel(paduid) % seg.padPositionX(paduid) %
-                            seg.padPositionY(paduid)
-                            % seg.padSizeX(paduid) % seg.padSizeY(paduid));
+  for (auto axis = 0; axis < 2; ++axis) {
+    T origin = axis == 0 ? x : y;
+    T direction = axis == 0 ? dx : dy;
+    T low = axis == 0 ? xmin : ymin;
+    T high = axis == 0 ? xmax : ymax;
+    if (direction == 0.0) {
+      if (origin < low || origin > high) {
+        return false;
+      }
+      continue;
+    }
+    T t1 = (low - origin) / direction;
+    T t2 = (high - origin) / direction;
+    tmin = std::max(tmin, std::min(t1, t2));
+    tmax = std::min(tmax, std::max(t1, t2));
+    if (tmin > tmax) {
+      return false;
+    }
   }
+  return true;
+}
 }
 
+template<typename T>
+T SegmentationT<T>::squaredDistanceToPad(int paduid, T x, T y) const
+{
+  T hx = mPadSizeX[paduid] / 2.0;
+  T hy = mPadSizeY[paduid] / 2.0;
+  return squaredDistance(mPadPositionX[paduid] - hx, mPadPositionY[paduid] - hy,
+                         mPadPositionX[paduid] + hx, mPadPositionY[paduid] + hy, x, y);
+}
 
-/// Starting from {xstart,ystart} and moving towards {xend,ystart}
-/// return the first valid paduid found
-/// FIXME: very basic algorithm for the moment. There is certainly room for
-/// improvement _if_ this method shows up at some point in performance
-/// _measurements_
-int Segmentation::findClosestX(double xstart, double ystart, double xend) const
+template<typename T>
+int SegmentationT<T>::findClosestPad(T x, T y) const
 {
-  double xstep{0.1}; // cm
+  int paduid = findPadByPosition(x, y);
+  if (isValid(paduid)) {
+    return paduid;
+  }
 
-  if (xstart > xend) {
-    for (auto x = xstart; x > xend; x -= xstep) {
-      int paduid{findPadByPosition(x, ystart)};
-      if (isValid(paduid)) {
-        return paduid;
+  if (!std::isfinite(x) || !std::isfinite(y) || mPadGroups.empty()) {
+    return InvalidPadUid;
+  }
+
+  // search the pads of the pad groups the grid (or the cuts) gives around
+  // (x,y), by increasing distance, until the pad groups left are further
+  // than the closest pad found so far. Within those, only the pad groups
+  // whose bounding box might hold a closer pad are searched.
+  // The pads of a pad group have consecutive paduids.
+  T best{std::numeric_limits<T>::max()};
+  auto searchPadGroup = [this, x, y, &best, &paduid](int padGroupIndex) {
+    const BBox &box = mPadGroupBBoxes[padGroupIndex];
+    if (squaredDistance(box.xmin(), box.ymin(), box.xmax(), box.ymax(), x, y) >= best) {
+      return best;
+    }
+    // when there is a pad at the position of the pad group (pads) grid the
+    // closest to (x,y), no other pad of that group can be closer
+    auto &pg = mPadGroups[padGroupIndex];
+    auto &pgt = mPadGroupTypes[pg.mPadGroupTypeId];
+    T fx = std::min<T>(std::max<T>((x - pg.mX) / mPadSizes[pg.mPadSizeId].first, T{0}), T(pgt.getNofPadsX() - 1));
+    T fy = std::min<T>(std::max<T>((y - pg.mY) / mPadSizes[pg.mPadSizeId].second, T{0}), T(pgt.getNofPadsY() - 1));
+    int closest = padUidByIndices(padGroupIndex, static_cast<int>(fx), static_cast<int>(fy));
+    if (isValid(closest)) {
+      T d = squaredDistanceToPad(closest, x, y);
+      if (d < best) {
+        best = d;
+        paduid = closest;
       }
+      return best;
     }
-  } else {
-    for (auto x = xstart; x < xend; x += xstep) {
-      int paduid{findPadByPosition(x, ystart)};
-      if (isValid(paduid)) {
-        return paduid;
+    for (auto p = mPadGroupPadOffsets[padGroupIndex]; p < mPadGroupPadOffsets[padGroupIndex + 1]; ++p) {
+      T d = squaredDistanceToPad(p, x, y);
+      if (d < best) {
+        best = d;
+        paduid = p;
       }
     }
-
-  }
-  return InvalidPadUid;
+    return best;
+  };
+  withPadGroupIndex([&](const auto &index) { index.forEachCandidateNear(x, y, searchPadGroup); });
+  return paduid;
 }
 
-int Segmentation::findClosestY(double xstart, double ystart, double yend) const
+template<typename T>
+int SegmentationT<T>::findClosestPad(T x, T y, T dx, T dy) const
 {
-  double ystep{0.1}; // cm
-
-  if (ystart > yend) {
-    for (auto y = ystart; y > yend; y -= ystep) {
-      int paduid{findPadByPosition(xstart, y)};
-      if (isValid(paduid)) {
-        return paduid;
-      }
+  // for each pad group around the segment, find the entry point
+  // of the segment into each of its pads, and keep the smallest one.
+  // The area given to the grid (or the cuts) is enlarged by a micron,
+  // so the pad groups along which the segment is running are included.
+  int paduid{InvalidPadUid};
+  T best{std::numeric_limits<T>::max()};
+  const T epsilon{1E-4};
+
+  auto searchPadGroup = [&](int padGroupIndex) {
+    const BBox &box = mPadGroupBBoxes[padGroupIndex];
+    T tmin{0.0};
+    T tmax{1.0};
+    if (!clip(box.xmin(), box.ymin(), box.xmax(), box.ymax(), x, y, dx, dy, tmin, tmax) || tmin >= best) {
+      return;
     }
-  } else {
-    for (auto y = ystart; y < yend; y += ystep) {
-      int paduid{findPadByPosition(xstart, y)};
-      if (isValid(paduid)) {
-        return paduid;
+    for (auto p = mPadGroupPadOffsets[padGroupIndex]; p < mPadGroupPadOffsets[padGroupIndex + 1]; ++p) {
+      T hx = mPadSizeX[p] / 2.0;
+      T hy = mPadSizeY[p] / 2.0;
+      tmin = 0.0;
+      tmax = 1.0;
+      if (clip(mPadPositionX[p] - hx, mPadPositionY[p] - hy, mPadPositionX[p] + hx, mPadPositionY[p] + hy,
+               x, y, dx, dy, tmin, tmax) && tmin < best) {
+        best = tmin;
+        paduid = p;
       }
     }
-  }
-  return InvalidPadUid;
+  };
+
+  withPadGroupIndex([&](const auto &index) {
+    index.forEachCandidate(std::min(x, x + dx) - epsilon, std::min(y, y + dy) - epsilon,
+                           std::max(x, x + dx) + epsilon, std::max(y, y + dy) + epsilon, searchPadGroup);
+  });
+  return paduid;
 }
 
-/// Return the corner pads of the intersection of box with this segmentation
-std::vector<int> Segmentation::intersect(const BBox &box) const
+template<typename T>
+std::array<int, 4> SegmentationT<T>::intersect(const BBox &box) const
 {
   auto b = o2::mch::contour::intersect(box, mBBox);
-  const double epsilon{2E-4};
+  const T epsilon{2E-4};
 
-  double xmin{b.xmin() + epsilon};
-  double ymin{b.ymin() + epsilon};
-  double xmax{b.xmax() - epsilon};
-  double ymax{b.ymax() - epsilon};
+  T xmin{b.xmin() + epsilon};
+  T ymin{b.ymin() + epsilon};
+  T xmax{b.xmax() - epsilon};
+  T ymax{b.ymax() - epsilon};
 
   int topLeft = findPadByPosition(xmin, ymax);
   int bottomLeft = findPadByPosition(xmin, ymin);
@@ -289,150 +616,83 @@ std::vector<int> Segmentation::intersect(const BBox &box) const
   // can happen when envelop is not the same as the bounding box, e.g.
   // for quadrants or rounded slats.
   //
-  // in each case we sweep along an horizontal or vertical line
-  // to find the first valid pad
+  // in each case we look along an horizontal or vertical line
+  // for the first valid pad
 
   if (!isValid(topRight)) {
-    topRight = findClosestX(xmax, ymax, xmin);
+    topRight = findClosestPad(xmax, ymax, xmin - xmax, 0.0);
     if (!isValid(topRight)) {
-      topRight = findClosestY(xmin, ymax, ymin);
+      topRight = findClosestPad(xmax, ymax, 0.0, ymin - ymax);
     }
   }
   if (!isValid(bottomRight)) {
-    bottomRight = findClosestX(xmax, ymin, xmin);
+    bottomRight = findClosestPad(xmax, ymin, xmin - xmax, 0.0);
     if (!isValid(bottomRight)) {
-      bottomRight = findClosestY(xmax, ymin, ymax);
+      bottomRight = findClosestPad(xmax, ymin, 0.0, ymax - ymin);
     }
   }
   if (!isValid(topLeft)) {
-    topLeft = findClosestX(xmin, ymax, xmax);
+    topLeft = findClosestPad(xmin, ymax, xmax - xmin, 0.0);
     if (!isValid(topLeft)) {
-      topLeft = findClosestY(xmin, ymax, ymin);
+      topLeft = findClosestPad(xmin, ymax, 0.0, ymin - ymax);
     }
   }
   if (!isValid(bottomLeft)) {
-    bottomLeft = findClosestX(xmin, ymin, xmax);
+    bottomLeft = findClosestPad(xmin, ymin, xmax - xmin, 0.0);
     if (!isValid(bottomLeft)) {
-      bottomLeft = findClosestY(xmin, ymin, ymax);
+      bottomLeft = findClosestPad(xmin, ymin, 0.0, ymax - ymin);
     }
   }
   return {topLeft, bottomLeft, bottomRight, topRight};
 }
 
-std::vector<int> Segmentation::getPadUids(const BBox &area) const
+template<typename T>
+std::vector<int> SegmentationT<T>::getPadUids(const BBox &area) const
 {
-  std::vector<int> corners = intersect(area);
-
-  // use the smallest corner pads to decide on traversal steps in x and y
-  double xstep{std::numeric_limits<double>::max()};
-  double ystep{std::numeric_limits<double>::max()};
-
-  double xstart{std::numeric_limits<double>::max()};
-  double xend{std::numeric_limits<double>::lowest()};
-  double ystart{std::numeric_limits<double>::max()};
-  double yend{std::numeric_limits<double>::lowest()};
-
   std::vector<int> paduids;
-
-  for (auto puid: corners) {
-    if (isValid(puid)) {
-      xstep = std::min(xstep, padSizeX(puid));
-      ystep = std::min(ystep, padSizeY(puid));
-      xstart = std::min(xstart, padPositionX(puid));
-      xend = std::max(xend, padPositionX(puid));
-      ystart = std::min(ystart, padPositionY(puid));
-      yend = std::max(yend, padPositionY(puid));
-      paduids.push_back(puid);
-    }
-  }
-
-  dumpPads("--- corners", *this, paduids);
-  std::cout << boost::format("x,y start = %7.2f %7.2f x,y end = %7.2f %7.2f x,y step = %7.2f %7.2f\n") %
-               xstart % ystart % xend % yend % xstep % ystep;
-
-  for (auto x = xstart; x < xend; x += xstep) {
-    for (auto y = ystart; y < yend; y += ystep) {
-      paduids.push_back(findPadByPosition(x, y));
-    }
-  }
-
-  for (auto y = ystart; y < yend; y += ystep) {
-    paduids.push_back(findPadByPosition(xend, y));
-  }
-
-  for (auto x = xstart; x < xend; x += xstep) {
-    //paduids.push_back(findPadByPosition(x, yend));
-    int p = findPadByPosition(x, ystart);
-    if (isValid(p)) {
-      paduids.push_back(p);
-//      std::stringstream str;
-//      str << boost::format("x %7.2f y %7.2f") % x % ystart;
-//      dumpPads(str.str(),*this,{p});
-    }
-  }
-
-  paduids.push_back(findPadByPosition(xend, yend));
-
-  paduids = uniqueAndValid(paduids);
-  dumpPads("--- pads", *this, paduids);
+  forEachPadInArea(area, [&paduids](int paduid) { paduids.push_back(paduid); });
+  std::sort(paduids.begin(), paduids.end());
   return paduids;
 }
 
-const PadGroup &Segmentation::padGroup(int paduid) const
-{
-  return gsl::at(mPadGroups, padUid2padGroupIndex(paduid));
-}
-
-const PadGroupType &Segmentation::padGroupType(int paduid) const
-{
-  return gsl::at(mPadGroupTypes, padGroup(paduid).mPadGroupTypeId);
-}
-
-int Segmentation::findPadByFEE(int dualSampaId, int dualSampaChannel) const
+template<typename T>
+MemoryUsage SegmentationT<T>::memoryUsage() const
 {
-  for (auto paduid: getPadUids(dualSampaId)) {
-    if (padGroupType(paduid).id(padUid2padGroupTypeFastIndex(paduid)) == dualSampaChannel) {
-      return paduid;
-    }
+  std::size_t padGroupTypes = heapMemoryUsage(mPadGroupTypes);
+  for (auto &pgt: mPadGroupTypes) {
+    padGroupTypes += pgt.heapMemoryUsage();
   }
-  return InvalidPadUid;
-}
-
-double Segmentation::padPositionX(int paduid) const
-{
-  auto &pg = padGroup(paduid);
-  auto &pgt = padGroupType(paduid);
-  return pg.mX + (pgt.ix(padUid2padGroupTypeFastIndex(paduid)) + 0.5) * mPadSizes[pg.mPadSizeId].first;
-}
-
-double Segmentation::padPositionY(int paduid) const
-{
-  auto &pg = padGroup(paduid);
-  auto &pgt = padGroupType(paduid);
-  return pg.mY + (pgt.iy(padUid2padGroupTypeFastIndex(paduid)) + 0.5) * mPadSizes[pg.mPadSizeId].second;
-}
-
-double Segmentation::padSizeX(int paduid) const
-{
-  return mPadSizes[padGroup(paduid).mPadSizeId].first;
-}
-
-double Segmentation::padSizeY(int paduid) const
-{
-  return mPadSizes[padGroup(paduid).mPadSizeId].second;
-}
-
-int Segmentation::padDualSampaId(int paduid) const
-{
-  return padGroup(paduid).mFECId;
-}
-
-int Segmentation::padDualSampaChannel(int paduid) const
-{
-  return padGroupType(paduid).id(padUid2padGroupTypeFastIndex(paduid));
+  std::size_t padGroupContours = heapMemoryUsage(mPadGroupContours);
+  for (auto &c: mPadGroupContours) {
+    padGroupContours += heapMemoryUsage(c);
+  }
+  return {
+    {"object", sizeof(*this)},
+    {"padGroups", heapMemoryUsage(mPadGroups)},
+    {"dualSampaIds", heapMemoryUsage(mDualSampaIds)},
+    {"padGroupTypes", padGroupTypes},
+    {"padSizes", heapMemoryUsage(mPadSizes)},
+    {"padGroupContours", padGroupContours},
+    {"padGroupBBoxes", heapMemoryUsage(mPadGroupBBoxes)},
+    {"envelop", heapMemoryUsage(mEnvelop)},
+    {"padGroupIndex", withPadGroupIndex([](const auto &index) { return index.heapMemoryUsage(); })},
+    {"padGroupPadOffsets", heapMemoryUsage(mPadGroupPadOffsets)},
+    {"padPositionX", heapMemoryUsage(mPadPositionX)},
+    {"padPositionY", heapMemoryUsage(mPadPositionY)},
+    {"padSizeX", heapMemoryUsage(mPadSizeX)},
+    {"padSizeY", heapMemoryUsage(mPadSizeY)},
+    {"padDualSampaIds", heapMemoryUsage(mPadDualSampaIds)},
+    {"padDualSampaChannels", heapMemoryUsage(mPadDualSampaChannels)},
+    {"neighbourOffsets", heapMemoryUsage(mNeighbourOffsets)},
+    {"neighbourEdgeEnds", heapMemoryUsage(mNeighbourEdgeEnds)},
+    {"neighbours", heapMemoryUsage(mNeighbours)},
+    {"dualSampaIndices", heapMemoryUsage(mDualSampaIndices)},
+    {"dualSampaPadOffsets", heapMemoryUsage(mDualSampaPadOffsets)},
+    {"dualSampaPads", heapMemoryUsage(mDualSampaPads)},
+    {"feePadUids", heapMemoryUsage(mFEEPadUids)}
+  };
 }
 
-
 std::ostream &operator<<(std::ostream &out, const std::pair<float, float> &p)
 {
   out << p.first << "," << p.second;
@@ -451,7 +711,8 @@ void dump(std::ostream &out, const std::string &msg, const std::vector<T> &v, in
   }
 }
 
-std::ostream &operator<<(std::ostream &os, const Segmentation &seg)
+template<typename T>
+std::ostream &operator<<(std::ostream &os, const SegmentationT<T> &seg)
 {
   os << "segType " << seg.mSegType << "-" << (seg.mIsBendingPlane ? "B" : "NB");
 
@@ -464,6 +725,12 @@ std::ostream &operator<<(std::ostream &os, const Segmentation &seg)
   return os;
 }
 
+template class SegmentationT<float>;
+template class SegmentationT<double>;
+
+template std::ostream &operator<<(std::ostream &os, const SegmentationT<float> &seg);
+template std::ostream &operator<<(std::ostream &os, const SegmentationT<double> &seg);
+
 }
 }
 }
@@ -16,11 +16,19 @@
 #ifndef O2_MCH_MAPPING_IMPL2_SEGMENTATION_H
 #define O2_MCH_MAPPING_IMPL2_SEGMENTATION_H
 
+#include "boxGrid.h"
+#include "memoryUsage.h"
 #include "padGroup.h"
 #include "padGroupType.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <vector>
 #include <set>
 #include <ostream>
+#include <utility>
+#include <gsl/gsl>
+#include <boost/variant.hpp>
 #include "polygon.h"
 #include "bbox.h"
 
@@ -29,94 +37,250 @@ namespace mch {
 namespace mapping {
 namespace impl2 {
 
-class Segmentation
+/// How a segmentation finds the pad groups that might contain a position
+enum class PadGroupLookup
 {
-  public:
+    Grid, ///< uniform grid (PadGroupGrid), for irregular layouts, e.g. quadrants
+    Cuts ///< binary search over the pad groups x- and y-boundaries (PadGroupCuts), for slats
+};
 
-    static constexpr int InvalidPadUid{-1};
-    using Polygon = o2::mch::contour::Polygon<double>;
-    using BBox = o2::mch::contour::BBox<double>;
+/// The pad groups of a segmentation indexed on a uniform grid
+template<typename T>
+using PadGroupGrid = o2::mch::mapping::BoxGrid<o2::mch::mapping::UniformAxis<T>>;
 
-    Segmentation(int segType, bool isBendingPlane, std::vector<PadGroup> padGroups);
+/// The pad groups of a segmentation indexed on the cells delimited
+/// by their x- and y-boundaries
+template<typename T>
+using PadGroupCuts = o2::mch::mapping::BoxGrid<o2::mch::mapping::CutsAxis<T>>;
 
-    Segmentation(int segType, bool isBendingPlane, std::vector<PadGroup> padGroups,
-                 std::vector<PadGroupType> padGroupTypes,
-                 std::vector<std::pair<float, float>> padSizes);
+/// The pad group index of a segmentation : only the one of the
+/// lookup strategy selected for its segType is built and stored
+template<typename T>
+using PadGroupIndex = boost::variant<PadGroupGrid<T>, PadGroupCuts<T>>;
 
-    /// Return the list of paduids for the pads of the given dual sampa.
-    std::vector<int> getPadUids(int dualSampaIds) const;
+/// The segmentation of one plane of one segmentation type.
+///
+/// T is the coordinate type used for the pad group contours, the bounding
+/// boxes, the pad positions and the position queries. Segmentation
+/// (i.e. SegmentationT<double>) is the reference one, while
+/// SegmentationT<float> halves the memory of the per-pad tables and
+/// doubles the number of SIMD lanes of the batched lookups, at the price
+/// of a coarser (a few tenths of a micron) precision near the pad edges.
+///
+/// All the tables are built by the constructor, so the const methods
+/// can be called concurrently from any number of threads. They do not
+/// allocate any memory either (except getPadUids(BBox), which returns
+/// a vector, and for which forEachPadInArea is the allocation-free
+/// alternative), so malloc is not a contention point.
+template<typename T>
+class SegmentationT
+{
+  public:
+
+    static constexpr int InvalidPadUid{-1};
+    static constexpr int NofDualSampaChannels{64};
+    using Polygon = o2::mch::contour::Polygon<T>;
+    using BBox = o2::mch::contour::BBox<T>;
+
+    SegmentationT(int segType, bool isBendingPlane, std::vector<PadGroup> padGroups);
+
+    SegmentationT(int segType, bool isBendingPlane, std::vector<PadGroup> padGroups,
+                  std::vector<PadGroupType> padGroupTypes,
+                  std::vector<std::pair<float, float>> padSizes,
+                  PadGroupLookup padGroupLookup = PadGroupLookup::Grid);
+
+    /// Build the same segmentation as other, but with another coordinate type
+    template<typename U>
+    explicit SegmentationT(const SegmentationT<U> &other)
+      : SegmentationT(other.mSegType, other.mIsBendingPlane, other.mPadGroups, other.mPadGroupTypes, other.mPadSizes,
+                      other.padGroupLookup())
+    {}
+
+    /// Return the list of paduids for the pads of the given dual sampa
+    /// (empty if the dual sampa is not part of this segmentation).
+    /// The returned span points to an internal table.
+    gsl::span<const int> getPadUids(int dualSampaId) const
+    {
+      int index = dualSampaIndex(dualSampaId);
+      if (index < 0) {
+        return {};
+      }
+      return {mDualSampaPads.data() + mDualSampaPadOffsets[index],
+              mDualSampaPadOffsets[index + 1] - mDualSampaPadOffsets[index]};
+    }
 
-    /// Return the list of paduids for the pads contained in the box
+    /// Return the list of paduids (in increasing order) for the pads overlapping the box
     std::vector<int> getPadUids(const BBox &box) const;
 
-    std::set<int> dualSampaIds() const
+    /// Call func(paduid) once for each pad overlapping the area, i.e. whose
+    /// surface (without its edges) intersects [xmin,xmax]x[ymin,ymax], so
+    /// pads only touching the area are not visited, while a zero width (or
+    /// height) area gives the pads it crosses.
+    /// Only the pad groups found around the area by the grid (or the cuts)
+    /// are considered, and only their pads within the area are visited.
+    /// The pads are visited pad group after pad group (in no particular order),
+    /// in increasing paduid order within a pad group. No memory is allocated.
+    template<typename CALLABLE>
+    void forEachPadInArea(T xmin, T ymin, T xmax, T ymax, CALLABLE &&func) const;
+
+    template<typename CALLABLE>
+    void forEachPadInArea(const BBox &area, CALLABLE &&func) const
+    { forEachPadInArea(area.xmin(), area.ymin(), area.xmax(), area.ymax(), std::forward<CALLABLE>(func)); }
+
+    const std::set<int> &dualSampaIds() const
     { return mDualSampaIds; }
 
-    int findPadByPosition(double x, double y) const;
+    int findPadByPosition(T x, T y) const;
 
-    int findPadByFEE(int dualSampaId, int dualSampaChannel) const;
+    /// Find the pads at positions (x[i],y[i]) and store their uids
+    /// into paduids[i] (InvalidPadUid if there is no pad at that position).
+    /// The three spans must have the same size.
+    void findPadByPositions(gsl::span<const T> x, gsl::span<const T> y, gsl::span<int> paduids) const;
 
-    bool hasPadByPosition(double x, double y) const
+    int findPadByFEE(int dualSampaId, int dualSampaChannel) const
+    {
+      int index = dualSampaIndex(dualSampaId);
+      if (index < 0 || dualSampaChannel < 0 || dualSampaChannel >= NofDualSampaChannels) {
+        return InvalidPadUid;
+      }
+      return mFEEPadUids[index * NofDualSampaChannels + dualSampaChannel];
+    }
+
+    bool hasPadByPosition(T x, T y) const
     { return findPadByPosition(x, y) != InvalidPadUid; }
 
     bool hasPadByFEE(int dualSampaId, int dualSampaChannel) const
     { return findPadByFEE(dualSampaId, dualSampaChannel) != InvalidPadUid; }
 
-    friend std::ostream &operator<<(std::ostream &os, const Segmentation &seg);
+    template<typename U>
+    friend std::ostream &operator<<(std::ostream &os, const SegmentationT<U> &seg);
 
-    double padPositionX(int paduid) const;
+    /// Return the number of pads of this segmentation.
+    /// Valid paduids are dense, in the range 0..nofPads()-1,
+    /// so per-pad client arrays can be sized exactly.
+    int nofPads() const
+    { return mPadPositionX.size(); }
 
-    double padPositionY(int paduid) const;
+    T padPositionX(int paduid) const
+    { return gsl::at(mPadPositionX, paduid); }
 
-    double padSizeX(int paduid) const;
+    T padPositionY(int paduid) const
+    { return gsl::at(mPadPositionY, paduid); }
 
-    double padSizeY(int paduid) const;
+    T padSizeX(int paduid) const
+    { return gsl::at(mPadSizeX, paduid); }
 
-    int padDualSampaId(int paduid) const;
+    T padSizeY(int paduid) const
+    { return gsl::at(mPadSizeY, paduid); }
 
-    int padDualSampaChannel(int paduid) const;
+    int padDualSampaId(int paduid) const
+    { return gsl::at(mPadDualSampaIds, paduid); }
+
+    int padDualSampaChannel(int paduid) const
+    { return gsl::at(mPadDualSampaChannels, paduid); }
 
     BBox bbox() const
     { return mBBox; }
 
-    std::vector<int> intersect(const BBox &box) const;
-
-  private:
-    int dualSampaIndex(int dualSampaId) const;
-
-    const PadGroup &padGroup(int paduid) const;
-
-    const PadGroupType &padGroupType(int paduid) const;
-
-    std::vector<int> findPadGroupIndices(double x, double y) const;
+    /// Return the number of bytes used by this segmentation,
+    /// broken down per member (see MemoryUsage)
+    MemoryUsage memoryUsage() const;
+
+    /// Return the corner pads (top left, bottom left, bottom right and
+    /// top right) of the intersection of box with this segmentation
+    std::array<int, 4> intersect(const BBox &box) const;
+
+    /// Return the valid pad closest to (x,y), i.e. the pad at (x,y)
+    /// if there is one, or the pad with the smallest distance between
+    /// its area and (x,y) otherwise (e.g. for a position in a dead zone)
+    int findClosestPad(T x, T y) const;
+
+    /// Return the first valid pad met when moving along the segment
+    /// going from (x,y) to (x+dx,y+dy), or InvalidPadUid if that segment
+    /// does not cross any pad
+    int findClosestPad(T x, T y, T dx, T dy) const;
+
+    /// Return the uids of the pads touching the given pad,
+    /// either by an edge or by a corner.
+    /// The returned span points to an internal table, built once at
+    /// construction time.
+    gsl::span<const int> getNeighbours(int paduid) const
+    {
+      if (paduid < 0 || paduid >= mNeighbourEdgeEnds.size()) {
+        return {};
+      }
+      return {mNeighbours.data() + mNeighbourOffsets[paduid], mNeighbourOffsets[paduid + 1] - mNeighbourOffsets[paduid]};
+    }
 
-    int padUid2padGroupIndex(int paduid) const
+    /// Same as getNeighbours but for the pads sharing an edge
+    /// with the given pad only (i.e. corner neighbours are excluded)
+    gsl::span<const int> getEdgeNeighbours(int paduid) const
     {
-      return paduid / mMaxFastIndex;
+      if (paduid < 0 || paduid >= mNeighbourEdgeEnds.size()) {
+        return {};
+      }
+      return {mNeighbours.data() + mNeighbourOffsets[paduid], mNeighbourEdgeEnds[paduid] - mNeighbourOffsets[paduid]};
     }
 
-    int padUid2padGroupTypeFastIndex(int paduid) const
+  private:
+    /// Return the position of dualSampaId within dualSampaIds(),
+    /// or -1 if it is not part of this segmentation
+    int dualSampaIndex(int dualSampaId) const
     {
-      return paduid - padUid2padGroupIndex(paduid) * mMaxFastIndex;
+      if (dualSampaId < 0 || dualSampaId >= mDualSampaIndices.size()) {
+        return -1;
+      }
+      return mDualSampaIndices[dualSampaId];
     }
 
+    /// Pads are numbered pad group after pad group, in
+    /// fastIndex order within each pad group
     int padUid(int padGroupIndex, int padGroupTypeFastIndex) const
     {
-
-      return padGroupIndex * mMaxFastIndex + padGroupTypeFastIndex;
+      auto &pgt = mPadGroupTypes[mPadGroups[padGroupIndex].mPadGroupTypeId];
+      return mPadGroupPadOffsets[padGroupIndex] + pgt.padIndex(padGroupTypeFastIndex);
     }
 
-    int padUid(int padGroupIndex, double x, double y) const;
+    int padUid(int padGroupIndex, T x, T y) const;
+
+    /// Return func(index), where index is the PadGroupGrid or the
+    /// PadGroupCuts of this segmentation. func is compiled for each of
+    /// them, so the lookup strategy is dispatched to once per call, and
+    /// the queries written as such calls get a code path per strategy.
+    template<typename CALLABLE>
+    decltype(auto) withPadGroupIndex(CALLABLE &&func) const
+    { return boost::apply_visitor(std::forward<CALLABLE>(func), mPadGroupIndex); }
+
+    PadGroupLookup padGroupLookup() const
+    { return boost::get<PadGroupCuts<T>>(&mPadGroupIndex) ? PadGroupLookup::Cuts : PadGroupLookup::Grid; }
+
+    template<typename INDEX>
+    int findPadByPosition(const INDEX &index, T x, T y) const;
+
+    template<typename INDEX>
+    void findPadByPositions(const INDEX &index, gsl::span<const T> x, gsl::span<const T> y,
+                            gsl::span<int> paduids) const;
 
-    std::vector<int> uniqueAndValid(std::vector<int> paduids) const;
+    int padUidByIndices(int padGroupIndex, int ix, int iy) const;
+
+    template<typename INDEX>
+    int firstPadGroupContaining(const INDEX &index, T x, T y, bool &hasOtherCandidates) const;
 
     bool isValid(int paduid) const
     { return paduid != InvalidPadUid; }
 
-    int findClosestX(double xstart, double ystart, double xend) const;
-    int findClosestY(double xstart, double ystart, double yend) const;
+    void computePadTable();
+
+    void computeNeighbours();
+
+    void computeFEETables();
+
+    T squaredDistanceToPad(int paduid, T x, T y) const;
 
   private:
+    template<typename>
+    friend class SegmentationT;
+
     int mSegType;
     bool mIsBendingPlane;
     std::vector<PadGroup> mPadGroups;
@@ -124,11 +288,75 @@ class Segmentation
     std::vector<PadGroupType> mPadGroupTypes;
     std::vector<std::pair<float, float>> mPadSizes;
     std::vector<Polygon> mPadGroupContours;
+    std::vector<BBox> mPadGroupBBoxes;
     Polygon mEnvelop;
     BBox mBBox;
-    int mMaxFastIndex;
+    PadGroupIndex<T> mPadGroupIndex;
+    std::vector<int> mPadGroupPadOffsets; // indexed by padGroupIndex
+    std::vector<T> mPadPositionX; // indexed by paduid
+    std::vector<T> mPadPositionY; // indexed by paduid
+    std::vector<float> mPadSizeX; // indexed by paduid
+    std::vector<float> mPadSizeY; // indexed by paduid
+    std::vector<int> mPadDualSampaIds; // indexed by paduid
+    std::vector<int> mPadDualSampaChannels; // indexed by paduid
+    std::vector<int> mNeighbourOffsets; // indexed by paduid
+    std::vector<int> mNeighbourEdgeEnds; // indexed by paduid
+    std::vector<int> mNeighbours;
+    std::vector<int> mDualSampaIndices; // indexed by dualSampaId
+    std::vector<int> mDualSampaPadOffsets; // indexed by dualSampaIndex
+    std::vector<int> mDualSampaPads;
+    std::vector<int> mFEEPadUids; // indexed by dualSampaIndex*NofDualSampaChannels+channel
 };
 
+template<typename T>
+constexpr int SegmentationT<T>::InvalidPadUid;
+
+template<typename T>
+constexpr int SegmentationT<T>::NofDualSampaChannels;
+
+template<typename T>
+std::ostream &operator<<(std::ostream &os, const SegmentationT<T> &seg);
+
+using Segmentation = SegmentationT<double>;
+
+extern template class SegmentationT<float>;
+extern template class SegmentationT<double>;
+
+template<typename T>
+template<typename CALLABLE>
+void SegmentationT<T>::forEachPadInArea(T areaXmin, T areaYmin, T areaXmax, T areaYmax, CALLABLE &&func) const
+{
+  auto visitPadGroup = [&](int padGroupIndex) {
+    const BBox &box = mPadGroupBBoxes[padGroupIndex];
+    if (box.xmax() <= areaXmin || box.xmin() >= areaXmax || box.ymax() <= areaYmin || box.ymin() >= areaYmax) {
+      return;
+    }
+    auto &pg = mPadGroups[padGroupIndex];
+    auto &pgt = mPadGroupTypes[pg.mPadGroupTypeId];
+    T padSizeX = mPadSizes[pg.mPadSizeId].first;
+    T padSizeY = mPadSizes[pg.mPadSizeId].second;
+    // index ranges of the pads overlapping the area, clipped to the pad group
+    T xmin = std::max(areaXmin, box.xmin()) - pg.mX;
+    T xmax = std::min(areaXmax, box.xmax()) - pg.mX;
+    T ymin = std::max(areaYmin, box.ymin()) - pg.mY;
+    T ymax = std::min(areaYmax, box.ymax()) - pg.mY;
+    int ixmin = std::max(0, static_cast<int>(std::floor(xmin / padSizeX)));
+    int ixmax = std::min(pgt.getNofPadsX() - 1, static_cast<int>(std::ceil(xmax / padSizeX)) - 1);
+    int iymin = std::max(0, static_cast<int>(std::floor(ymin / padSizeY)));
+    int iymax = std::min(pgt.getNofPadsY() - 1, static_cast<int>(std::ceil(ymax / padSizeY)) - 1);
+    for (auto iy = iymin; iy <= iymax; ++iy) {
+      for (auto ix = ixmin; ix <= ixmax; ++ix) {
+        if (pgt.hasPad(pgt.fastIndex(ix, iy))) {
+          func(padUid(padGroupIndex, pgt.fastIndex(ix, iy)));
+        }
+      }
+    }
+  };
+  withPadGroupIndex([&](const auto &index) {
+    index.forEachCandidate(areaXmin, areaYmin, areaXmax, areaYmax, visitPadGroup);
+  });
+}
+
 Segmentation *createSegmentation(int detElemId, bool isBendingPlane);
 }
 }
@@ -0,0 +1,151 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+// Throughput of the segmentation queries when run from several threads
+// at once, all sharing the same (cached) segmentations.
+//
+// The "queries" counter is the number of queries per second and per thread,
+// so it should stay (about) constant when the number of threads increases,
+// up to the number of physical cores. A drop is the sign of a contention
+// (e.g. a lock or a memory allocation) on the query path.
+//
+// To use it as a regression gate, compare the json output of two builds, e.g.
+// benchConcurrentQueries --benchmark_format=json --benchmark_out=new.json
+
+#include "benchmark/benchmark.h"
+#include "segmentationCreator.h"
+#include "GenerateTestPoints.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using o2::mch::mapping::generateTestPoints;
+using o2::mch::mapping::impl2::Segmentation;
+using o2::mch::mapping::impl2::getSegmentation;
+
+namespace {
+
+constexpr int NTESTPOINTS{1000};
+
+// the areas are about the size of a cluster
+constexpr double AreaHalfSize{2.0};
+
+struct TestSample
+{
+    const Segmentation *seg;
+    std::vector<std::pair<double, double>> positions;
+    std::vector<std::pair<int, int>> fees;
+};
+
+/// Build (once) a sample of positions and of (dualSampaId,channel)
+/// for each plane of each segmentation type
+const std::vector<TestSample> &testSamples()
+{
+  static const std::vector<TestSample> samples = [] {
+    std::vector<TestSample> v;
+    for (auto segType = 0; segType < 21; ++segType) {
+      for (auto isBendingPlane : {true, false}) {
+        const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+        auto bbox = seg.bbox();
+        TestSample sample{&seg, generateTestPoints(NTESTPOINTS, bbox.xmin(), bbox.ymin(), bbox.xmax(), bbox.ymax(), 0),
+                          {}};
+        for (auto i = 0; i < NTESTPOINTS; ++i) {
+          int paduid = i % seg.nofPads();
+          sample.fees.emplace_back(seg.padDualSampaId(paduid), seg.padDualSampaChannel(paduid));
+        }
+        v.push_back(std::move(sample));
+      }
+    }
+    return v;
+  }();
+  return samples;
+}
+
+int maxNofThreads()
+{
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+void setQueryCounter(benchmark::State &state, int64_t n)
+{
+  state.counters["queries"] = benchmark::Counter(n, benchmark::Counter::kAvgThreadsRate);
+}
+}
+
+static void benchConcurrentFindPadByPosition(benchmark::State &state)
+{
+  auto &samples = testSamples();
+  int64_t n{0};
+  int nin{0};
+
+  for (auto _ : state) {
+    for (const auto &sample: samples) {
+      for (const auto &p: sample.positions) {
+        nin += sample.seg->hasPadByPosition(p.first, p.second);
+      }
+      n += sample.positions.size();
+    }
+  }
+
+  benchmark::DoNotOptimize(nin);
+  setQueryCounter(state, n);
+}
+
+static void benchConcurrentFindPadByFEE(benchmark::State &state)
+{
+  auto &samples = testSamples();
+  int64_t n{0};
+  int nin{0};
+
+  for (auto _ : state) {
+    for (const auto &sample: samples) {
+      for (const auto &fee: sample.fees) {
+        nin += sample.seg->hasPadByFEE(fee.first, fee.second);
+      }
+      n += sample.fees.size();
+    }
+  }
+
+  benchmark::DoNotOptimize(nin);
+  setQueryCounter(state, n);
+}
+
+static void benchConcurrentForEachPadInArea(benchmark::State &state)
+{
+  auto &samples = testSamples();
+  int64_t n{0};
+  int npads{0};
+
+  for (auto _ : state) {
+    for (const auto &sample: samples) {
+      for (const auto &p: sample.positions) {
+        Segmentation::BBox area{p.first - AreaHalfSize, p.second - AreaHalfSize,
+                                p.first + AreaHalfSize, p.second + AreaHalfSize};
+        sample.seg->forEachPadInArea(area, [&npads](int) { ++npads; });
+      }
+      n += sample.positions.size();
+    }
+  }
+
+  benchmark::DoNotOptimize(npads);
+  setQueryCounter(state, n);
+}
+
+BENCHMARK(benchConcurrentFindPadByPosition)->ThreadRange(1, maxNofThreads())->UseRealTime()->Unit(
+  benchmark::kMillisecond);
+BENCHMARK(benchConcurrentFindPadByFEE)->ThreadRange(1, maxNofThreads())->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(benchConcurrentForEachPadInArea)->ThreadRange(1, maxNofThreads())->UseRealTime()->Unit(
+  benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,82 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#include "benchmark/benchmark.h"
+#include "segmentationCreator.h"
+#include <memory>
+
+using o2::mch::mapping::impl2::Segmentation;
+using o2::mch::mapping::impl2::getSegmentationCreator;
+
+static void segTypeList(benchmark::internal::Benchmark *b)
+{
+  for (auto segType = 0; segType < 21; ++segType) {
+    for (auto bending : {true, false}) {
+      b->Args({segType, bending});
+    }
+  }
+}
+
+static void benchFindPadByFEE(benchmark::State &state)
+{
+  int segType = state.range(0);
+  bool isBendingPlane = state.range(1);
+
+  std::unique_ptr<Segmentation> seg{getSegmentationCreator(segType)(isBendingPlane)};
+
+  auto dualSampaIds = seg->dualSampaIds();
+
+  int nin{0};
+  int n{0};
+
+  for (auto _ : state) {
+    for (auto dualSampaId: dualSampaIds) {
+      for (auto channel = 0; channel < Segmentation::NofDualSampaChannels; ++channel) {
+        n++;
+        nin += seg->hasPadByFEE(dualSampaId, channel);
+      }
+    }
+  }
+
+  state.counters["nin"] = benchmark::Counter(nin, benchmark::Counter::kIsRate);
+  state.counters["n"] = benchmark::Counter(n, benchmark::Counter::kIsRate);
+}
+
+static void benchGetPadUidsOfDualSampa(benchmark::State &state)
+{
+  int segType = state.range(0);
+  bool isBendingPlane = state.range(1);
+
+  std::unique_ptr<Segmentation> seg{getSegmentationCreator(segType)(isBendingPlane)};
+
+  auto dualSampaIds = seg->dualSampaIds();
+
+  int npads{0};
+
+  for (auto _ : state) {
+    for (auto dualSampaId: dualSampaIds) {
+      for (auto paduid: seg->getPadUids(dualSampaId)) {
+        benchmark::DoNotOptimize(paduid);
+        npads++;
+      }
+    }
+  }
+
+  state.counters["npads"] = benchmark::Counter(npads, benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(benchFindPadByFEE)->Apply(segTypeList)->Unit(benchmark::kMicrosecond);
+BENCHMARK(benchGetPadUidsOfDualSampa)->Apply(segTypeList)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
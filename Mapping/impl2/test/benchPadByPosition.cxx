@@ -0,0 +1,67 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#include "benchmark/benchmark.h"
+#include "segmentationCreator.h"
+#include "GenerateTestPoints.h"
+#include <memory>
+
+namespace {
+constexpr int NTESTPOINTS{1000};
+}
+
+using o2::mch::mapping::generateTestPoints;
+using o2::mch::mapping::impl2::Segmentation;
+using o2::mch::mapping::impl2::getSegmentationCreator;
+
+static void segTypeListWithExtent(benchmark::internal::Benchmark *b)
+{
+  for (auto segType = 0; segType < 21; ++segType) {
+    for (auto bending : {true, false}) {
+      for (auto extent : {0, 10}) {
+        b->Args({segType, bending, extent});
+      }
+    }
+  }
+}
+
+static void benchFindPadByPosition(benchmark::State &state)
+{
+  int segType = state.range(0);
+  bool isBendingPlane = state.range(1);
+  int extent = state.range(2);
+
+  std::unique_ptr<Segmentation> seg{getSegmentationCreator(segType)(isBendingPlane)};
+
+  auto bbox = seg->bbox();
+
+  auto testPoints = generateTestPoints(NTESTPOINTS, bbox.xmin(), bbox.ymin(), bbox.xmax(), bbox.ymax(), extent);
+
+  int nin{0};
+  int n{0};
+
+  for (auto _ : state) {
+    for (const auto &tp: testPoints) {
+      n++;
+      nin += seg->hasPadByPosition(tp.first, tp.second);
+    }
+  }
+
+  state.counters["nin"] = benchmark::Counter(nin, benchmark::Counter::kIsRate);
+  state.counters["n"] = benchmark::Counter(n, benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(benchFindPadByPosition)->Apply(segTypeListWithExtent)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
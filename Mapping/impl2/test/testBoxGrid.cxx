@@ -0,0 +1,178 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "boxGrid.h"
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace o2::mch::mapping;
+
+namespace {
+
+struct Box
+{
+    double xmin() const
+    { return x1; }
+
+    double ymin() const
+    { return y1; }
+
+    double xmax() const
+    { return x2; }
+
+    double ymax() const
+    { return y2; }
+
+    double x1, y1, x2, y2;
+};
+
+std::vector<Box> randomBoxes()
+{
+  std::mt19937 mt(1234);
+  std::uniform_real_distribution<double> position(-50, 50);
+  std::uniform_real_distribution<double> size(0.5, 8);
+  std::vector<Box> boxes;
+  for (auto i = 0; i < 200; ++i) {
+    double x = position(mt);
+    double y = position(mt);
+    boxes.push_back({x, y, x + size(mt), y + size(mt)});
+  }
+  return boxes;
+}
+
+bool contains(const Box &b, double x, double y)
+{
+  return x >= b.xmin() && x <= b.xmax() && y >= b.ymin() && y <= b.ymax();
+}
+
+bool overlaps(const Box &b, const Box &area)
+{
+  return b.xmax() > area.xmin() && b.xmin() < area.xmax() && b.ymax() > area.ymin() && b.ymin() < area.ymax();
+}
+
+double squaredDistance(const Box &b, double x, double y)
+{
+  double dx = std::max({b.xmin() - x, 0.0, x - b.xmax()});
+  double dy = std::max({b.ymin() - y, 0.0, y - b.ymax()});
+  return dx * dx + dy * dy;
+}
+
+template<typename GRID>
+void checkAgainstBruteForce(const GRID &grid, const std::vector<Box> &boxes)
+{
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> position(-70, 70);
+  std::uniform_real_distribution<double> size(0, 20);
+
+  for (auto n = 0; n < 1000; ++n) {
+    double x = position(mt);
+    double y = position(mt);
+
+    // every box containing (x,y) is a candidate
+    auto c = grid.candidates(x, y);
+    std::set<int> candidates(c.first, c.second);
+    for (auto i = 0; i < boxes.size(); ++i) {
+      if (contains(boxes[i], x, y)) {
+        BOOST_TEST(candidates.count(i) == 1);
+      }
+    }
+
+    // every box overlapping the area is a candidate, given once
+    Box area{x, y, x + size(mt), y + size(mt)};
+    std::vector<int> areaCandidates;
+    grid.forEachCandidate(area.xmin(), area.ymin(), area.xmax(), area.ymax(),
+                          [&areaCandidates](int i) { areaCandidates.push_back(i); });
+    std::set<int> unique(areaCandidates.begin(), areaCandidates.end());
+    BOOST_TEST(unique.size() == areaCandidates.size());
+    for (auto i = 0; i < boxes.size(); ++i) {
+      if (overlaps(boxes[i], area)) {
+        BOOST_TEST(unique.count(i) == 1);
+      }
+    }
+
+    // the closest box is met (once) before the search stops
+    double best{std::numeric_limits<double>::max()};
+    std::vector<int> nearCandidates;
+    grid.forEachCandidateNear(x, y, [&](int i) {
+      nearCandidates.push_back(i);
+      best = std::min(best, squaredDistance(boxes[i], x, y));
+      return best;
+    });
+    BOOST_TEST(std::set<int>(nearCandidates.begin(), nearCandidates.end()).size() == nearCandidates.size());
+    double expected{std::numeric_limits<double>::max()};
+    for (auto &b: boxes) {
+      expected = std::min(expected, squaredDistance(b, x, y));
+    }
+    BOOST_TEST(best == expected);
+  }
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(box_grid)
+
+BOOST_AUTO_TEST_CASE(UniformGridGivesTheSameBoxesAsABruteForceSearch)
+{
+  auto boxes = randomBoxes();
+  auto grid = createUniformBoxGrid<double>(boxes.size(), [&boxes](int i) { return boxes[i]; });
+  BOOST_TEST(grid.nofCellsX() > 1);
+  BOOST_TEST(grid.nofCellsY() > 1);
+  checkAgainstBruteForce(grid, boxes);
+}
+
+BOOST_AUTO_TEST_CASE(CutsGridGivesTheSameBoxesAsABruteForceSearch)
+{
+  auto boxes = randomBoxes();
+  auto grid = createCutsBoxGrid<double>(boxes.size(), [&boxes](int i) { return boxes[i]; });
+  BOOST_TEST(grid.nofCellsX() == 2 * boxes.size() - 1);
+  checkAgainstBruteForce(grid, boxes);
+}
+
+BOOST_AUTO_TEST_CASE(NaNOrFarAwayPositionsHaveNoCandidates)
+{
+  auto boxes = randomBoxes();
+  auto grid = createUniformBoxGrid<double>(boxes.size(), [&boxes](int i) { return boxes[i]; });
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  double inf = std::numeric_limits<double>::infinity();
+  for (auto p: std::vector<std::pair<double, double>>{{nan, 0}, {0, nan}, {inf, 0}, {-inf, 0}, {1E30, 1E30}}) {
+    auto c = grid.candidates(p.first, p.second);
+    BOOST_TEST((c.first == c.second));
+  }
+  int n{0};
+  grid.forEachCandidateNear(nan, 0.0, [&n](int) {
+    ++n;
+    return 0.0;
+  });
+  grid.forEachCandidate(nan, nan, nan, nan, [&n](int) { ++n; });
+  BOOST_TEST(n == 0);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyGridHasNoCandidates)
+{
+  auto grid = createCutsBoxGrid<double>(0, [](int) { return Box{}; });
+  auto c = grid.candidates(0, 0);
+  BOOST_TEST((c.first == c.second));
+  int n{0};
+  grid.forEachCandidate(-1, -1, 1, 1, [&n](int) { ++n; });
+  BOOST_TEST(n == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
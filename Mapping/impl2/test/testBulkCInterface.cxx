@@ -0,0 +1,172 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "segmentationCInterfaceExt.h"
+#include "segmentationCreator.h"
+#include "detectionElementCatalogue.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+
+namespace {
+
+void appendInt(void *data, int value)
+{
+  static_cast<std::vector<int> *>(data)->push_back(value);
+}
+
+std::vector<int> oneDetectionElementPerSegType()
+{
+  std::vector<int> detElemIds;
+  mchSegmentationForOneDetectionElementOfEachSegmentationType(appendInt, &detElemIds);
+  return detElemIds;
+}
+
+std::vector<int> dualSampaIds(MchSegmentationHandle handle)
+{
+  std::vector<int> ids;
+  mchSegmentationForEachDualSampa(handle, appendInt, &ids);
+  return ids;
+}
+
+/// All the pads of the segmentation, dual sampa after dual sampa
+std::vector<int> padUids(MchSegmentationHandle handle)
+{
+  std::vector<int> paduids;
+  for (auto dualSampaId: dualSampaIds(handle)) {
+    mchSegmentationForEachPadInDualSampa(handle, dualSampaId, appendInt, &paduids);
+  }
+  return paduids;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(bulk_c_interface)
+
+BOOST_AUTO_TEST_CASE(BulkFindPadByFEEsIsTheSameAsOneByOne)
+{
+  auto detElemIds = oneDetectionElementPerSegType();
+  BOOST_REQUIRE(detElemIds.size() == 21);
+  for (auto detElemId: detElemIds) {
+    for (auto isBendingPlane: {true, false}) {
+      auto handle = mchSegmentationConstruct(detElemId, isBendingPlane);
+      BOOST_REQUIRE(handle != nullptr);
+      std::vector<int> ids;
+      std::vector<int> channels;
+      for (auto dualSampaId: dualSampaIds(handle)) {
+        for (auto channel = -1; channel <= 64; ++channel) {
+          ids.push_back(dualSampaId);
+          channels.push_back(channel);
+        }
+      }
+      ids.push_back(-1);
+      channels.push_back(0);
+      std::vector<int> paduids(ids.size());
+      mchSegmentationFindPadByFEEs(handle, ids.size(), ids.data(), channels.data(), paduids.data());
+      for (auto i = 0; i < ids.size(); ++i) {
+        BOOST_TEST(paduids[i] == mchSegmentationFindPadByFEE(handle, ids[i], channels[i]));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BulkPadAttributesAreTheSameAsOneByOne)
+{
+  for (auto detElemId: oneDetectionElementPerSegType()) {
+    for (auto isBendingPlane: {true, false}) {
+      auto handle = mchSegmentationConstruct(detElemId, isBendingPlane);
+      auto paduids = padUids(handle);
+      const int n = paduids.size();
+      BOOST_TEST(n == getSegmentation(detElemId2SegType(detElemId), isBendingPlane).nofPads());
+      std::vector<double> x(n), y(n), dx(n), dy(n);
+      std::vector<int> dsIds(n), channels(n);
+      mchSegmentationPadAttributes(handle, n, paduids.data(), x.data(), y.data(), dx.data(), dy.data(),
+                                   dsIds.data(), channels.data());
+      for (auto i = 0; i < n; ++i) {
+        int paduid = paduids[i];
+        BOOST_TEST(x[i] == mchSegmentationPadPositionX(handle, paduid));
+        BOOST_TEST(y[i] == mchSegmentationPadPositionY(handle, paduid));
+        BOOST_TEST(dx[i] == mchSegmentationPadSizeX(handle, paduid));
+        BOOST_TEST(dy[i] == mchSegmentationPadSizeY(handle, paduid));
+        BOOST_TEST(dsIds[i] == mchSegmentationPadDualSampaId(handle, paduid));
+        BOOST_TEST(channels[i] == mchSegmentationPadDualSampaChannel(handle, paduid));
+      }
+
+      // the attributes whose array is null are not retrieved
+      std::vector<int> onlyChannels(n, -1);
+      mchSegmentationPadAttributes(handle, n, paduids.data(), nullptr, nullptr, nullptr, nullptr, nullptr,
+                                   onlyChannels.data());
+      BOOST_TEST(onlyChannels == channels);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(InvalidPadUidsGiveNaNOrMinusOneInsteadOfThrowing)
+{
+  auto handle = mchSegmentationConstruct(100, true);
+  const int nofPads = getSegmentation(0, true).nofPads();
+
+  // -1 being what the lookups give for a miss
+  std::vector<int> paduids{0, -1, nofPads - 1, nofPads, 1 << 30};
+  const int n = paduids.size();
+  std::vector<double> x(n), y(n), dx(n), dy(n);
+  std::vector<int> dsIds(n), channels(n);
+  mchSegmentationPadAttributes(handle, n, paduids.data(), x.data(), y.data(), dx.data(), dy.data(), dsIds.data(),
+                               channels.data());
+  for (auto i = 0; i < n; ++i) {
+    int paduid = paduids[i];
+    bool valid = paduid >= 0 && paduid < nofPads;
+    for (auto v: {x[i], y[i], dx[i], dy[i], mchSegmentationPadPositionX(handle, paduid),
+                  mchSegmentationPadPositionY(handle, paduid), mchSegmentationPadSizeX(handle, paduid),
+                  mchSegmentationPadSizeY(handle, paduid)}) {
+      BOOST_TEST(std::isnan(v) == !valid);
+    }
+    if (!valid) {
+      BOOST_TEST(dsIds[i] == -1);
+      BOOST_TEST(channels[i] == -1);
+    }
+    BOOST_TEST(dsIds[i] == mchSegmentationPadDualSampaId(handle, paduid));
+    BOOST_TEST(channels[i] == mchSegmentationPadDualSampaChannel(handle, paduid));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(EdgeNeighboursAreTheNeighboursSharingAnEdge)
+{
+  for (auto detElemId: oneDetectionElementPerSegType()) {
+    for (auto isBendingPlane: {true, false}) {
+      auto handle = mchSegmentationConstruct(detElemId, isBendingPlane);
+      const Segmentation &seg = getSegmentation(detElemId2SegType(detElemId), isBendingPlane);
+      for (auto paduid = 0; paduid < seg.nofPads(); paduid += 7) {
+        std::vector<int> edges;
+        mchSegmentationForEachEdgeNeighbouringPad(handle, paduid, appendInt, &edges);
+        auto expected = seg.getEdgeNeighbours(paduid);
+        BOOST_TEST(edges == std::vector<int>(expected.begin(), expected.end()));
+
+        // which are the first neighbours
+        std::vector<int> all;
+        mchSegmentationForEachNeighbouringPad(handle, paduid, appendInt, &all);
+        BOOST_REQUIRE(all.size() >= edges.size());
+        BOOST_TEST(std::equal(edges.begin(), edges.end(), all.begin()));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
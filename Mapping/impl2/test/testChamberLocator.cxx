@@ -0,0 +1,129 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "chamberLocator.h"
+#include "detectionElementCatalogue.h"
+#include "segmentationCreator.h"
+#include "GenerateTestPoints.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace o2::mch::mapping::impl2;
+using o2::mch::mapping::generateTestPoints;
+
+namespace {
+
+// three detection elements, far enough from each other not to overlap,
+// one of them being rotated and one being mirrored
+const std::vector<DetectionElementPlacement> testPlacements{
+  {500, 0.0, 0.0, 0.0, false},
+  {501, 0.0, 500.0, 90.0, false},
+  {502, 0.0, -500.0, 0.0, true}};
+
+void localToChamber(const DetectionElementPlacement &p, double x, double y, double &xc, double &yc)
+{
+  double angle = p.angle * std::acos(-1.0) / 180.0;
+  double xm = p.mirrored ? -x : x;
+  xc = p.x0 + std::cos(angle) * xm - std::sin(angle) * y;
+  yc = p.y0 + std::sin(angle) * xm + std::cos(angle) * y;
+}
+
+/// The bounding box of both cathodes of a detection element
+Segmentation::BBox envelope(int detElemId)
+{
+  int segType = detElemId2SegType(detElemId);
+  auto b = getSegmentation(segType, true).bbox();
+  auto nb = getSegmentation(segType, false).bbox();
+  return {std::min(b.xmin(), nb.xmin()), std::min(b.ymin(), nb.ymin()), std::max(b.xmax(), nb.xmax()),
+          std::max(b.ymax(), nb.ymax())};
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(chamber_locator)
+
+BOOST_AUTO_TEST_CASE(ThrowsIfDetectionElementDoesNotExist)
+{
+  BOOST_CHECK_THROW(ChamberLocator({{42, 0.0, 0.0, 0.0, false}}), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(PositionOutsideOfAllDetectionElementsGivesNothing)
+{
+  ChamberLocator locator{testPlacements};
+  auto location = locator.findPads(1000.0, 1000.0);
+  BOOST_CHECK_EQUAL(location.detElemId, -1);
+  BOOST_CHECK_EQUAL(location.bendingPadUid, Segmentation::InvalidPadUid);
+  BOOST_CHECK_EQUAL(location.nonBendingPadUid, Segmentation::InvalidPadUid);
+}
+
+BOOST_AUTO_TEST_CASE(SamePadsAsTheDetectionElementSegmentations)
+{
+  ChamberLocator locator{testPlacements};
+
+  for (auto &p: testPlacements) {
+    int segType = detElemId2SegType(p.detElemId);
+    const Segmentation &bending = getSegmentation(segType, true);
+    const Segmentation &nonBending = getSegmentation(segType, false);
+    auto bbox = bending.bbox();
+    for (auto &tp: generateTestPoints(1000, bbox.xmin(), bbox.ymin(), bbox.xmax(), bbox.ymax(), 0)) {
+      int b = bending.findPadByPosition(tp.first, tp.second);
+      int nb = nonBending.findPadByPosition(tp.first, tp.second);
+      if (b == Segmentation::InvalidPadUid && nb == Segmentation::InvalidPadUid) {
+        continue;
+      }
+      double x, y;
+      localToChamber(p, tp.first, tp.second, x, y);
+      auto location = locator.findPads(x, y);
+      BOOST_CHECK_EQUAL(location.detElemId, p.detElemId);
+      BOOST_CHECK_EQUAL(location.bendingPadUid, b);
+      BOOST_CHECK_EQUAL(location.nonBendingPadUid, nb);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PositionInTheGapBetweenTwoDetectionElementsGivesNothing)
+{
+  // two detection elements side by side, 2 cm apart
+  const double gap{2.0};
+  auto left = envelope(500);
+  auto right = envelope(501);
+  double x0 = left.xmax() - right.xmin() + gap;
+  ChamberLocator locator{{{500, 0.0, 0.0, 0.0, false}, {501, x0, 0.0, 0.0, false}}};
+
+  int nofFound{0};
+  for (auto y: {left.ymin() + 1.0, 0.0, left.ymax() - 1.0}) {
+    auto location = locator.findPads(left.xmax() + gap / 2, y);
+    BOOST_CHECK_EQUAL(location.detElemId, -1);
+    BOOST_CHECK_EQUAL(location.bendingPadUid, Segmentation::InvalidPadUid);
+    BOOST_CHECK_EQUAL(location.nonBendingPadUid, Segmentation::InvalidPadUid);
+
+    // while the positions on either side of the gap are in their detection element
+    // (when it has a pad there)
+    for (auto p: {std::make_pair(500, left.xmax() - 0.1), std::make_pair(501, x0 + right.xmin() + 0.1)}) {
+      auto l = locator.findPads(p.second, y);
+      BOOST_TEST((l.detElemId == p.first || l.detElemId == -1));
+      nofFound += l.detElemId == p.first;
+      BOOST_TEST((l.detElemId == -1) ==
+                 (l.bendingPadUid == Segmentation::InvalidPadUid && l.nonBendingPadUid == Segmentation::InvalidPadUid));
+    }
+  }
+  BOOST_TEST(nofFound > 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
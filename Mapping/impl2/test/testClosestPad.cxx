@@ -0,0 +1,227 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/monomorphic/generators/xrange.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "segmentationCreator.h"
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+
+namespace {
+
+bool isValid(int paduid)
+{
+  return paduid != Segmentation::InvalidPadUid;
+}
+
+double squaredDistanceToPad(const Segmentation &seg, int paduid, double x, double y)
+{
+  double dx = std::max(0.0, std::abs(x - seg.padPositionX(paduid)) - seg.padSizeX(paduid) / 2.0);
+  double dy = std::max(0.0, std::abs(y - seg.padPositionY(paduid)) - seg.padSizeY(paduid) / 2.0);
+  return dx * dx + dy * dy;
+}
+
+/// Smallest (squared) distance between (x,y) and a pad, by a loop over all the pads
+double bruteForceClosestDistance(const Segmentation &seg, double x, double y)
+{
+  double best{std::numeric_limits<double>::max()};
+  for (auto paduid = 0; paduid < seg.nofPads(); ++paduid) {
+    best = std::min(best, squaredDistanceToPad(seg, paduid, x, y));
+  }
+  return best;
+}
+
+/// Fraction of the segment from (x,y) to (x+dx,y+dy) where it enters
+/// the pad, or a negative value if the segment does not cross the pad
+double entry(const Segmentation &seg, int paduid, double x, double y, double dx, double dy)
+{
+  double tmin{0.0};
+  double tmax{1.0};
+  auto slab = [&tmin, &tmax](double v, double dv, double center, double halfSize) {
+    if (dv == 0) {
+      return std::abs(v - center) <= halfSize;
+    }
+    double t1 = (center - halfSize - v) / dv;
+    double t2 = (center + halfSize - v) / dv;
+    tmin = std::max(tmin, std::min(t1, t2));
+    tmax = std::min(tmax, std::max(t1, t2));
+    return tmin <= tmax;
+  };
+  if (slab(x, dx, seg.padPositionX(paduid), seg.padSizeX(paduid) / 2.0) &&
+      slab(y, dy, seg.padPositionY(paduid), seg.padSizeY(paduid) / 2.0)) {
+    return tmin;
+  }
+  return -1.0;
+}
+
+/// Smallest entry fraction of the segment into a pad, by a loop over all
+/// the pads, or a negative value if the segment does not cross any pad
+double bruteForceFirstEntry(const Segmentation &seg, double x, double y, double dx, double dy)
+{
+  double best{-1.0};
+  for (auto paduid = 0; paduid < seg.nofPads(); ++paduid) {
+    double t = entry(seg, paduid, x, y, dx, dy);
+    if (t >= 0 && (best < 0 || t < best)) {
+      best = t;
+    }
+  }
+  return best;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(closest_pad)
+
+BOOST_DATA_TEST_CASE(ClosestPadOfAPositionWithinAPadIsThatPad, boost::unit_test::data::xrange(21), segType)
+{
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    for (auto paduid = 0; paduid < seg.nofPads(); paduid += 97) {
+      BOOST_TEST(seg.findClosestPad(seg.padPositionX(paduid), seg.padPositionY(paduid)) == paduid);
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(ClosestPadInADeadZoneIsTheSameAsWithABruteForceSearch, boost::unit_test::data::xrange(21),
+                     segType)
+{
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    std::mt19937 mt(seg.nofPads());
+    auto box = seg.bbox();
+    std::uniform_real_distribution<double> x{box.xmin(), box.xmax()};
+    std::uniform_real_distribution<double> y{box.ymin(), box.ymax()};
+    int n{0};
+    for (auto i = 0; i < 10000 && n < 100; ++i) {
+      double px = x(mt);
+      double py = y(mt);
+      if (seg.hasPadByPosition(px, py)) {
+        continue;
+      }
+      ++n;
+      int paduid = seg.findClosestPad(px, py);
+      BOOST_REQUIRE(isValid(paduid));
+      BOOST_CHECK_CLOSE_FRACTION(squaredDistanceToPad(seg, paduid, px, py),
+                                 bruteForceClosestDistance(seg, px, py), 1E-6);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DeadZonesBetweenPadGroupsAreTested)
+{
+  // the dead zones of the station 1 quadrants are found between pad groups,
+  // so the test above does not only cover the positions around slats
+  const Segmentation &seg = getSegmentation(0, true);
+  auto box = seg.bbox();
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> x{box.xmin(), box.xmax()};
+  std::uniform_real_distribution<double> y{box.ymin(), box.ymax()};
+  int n{0};
+  for (auto i = 0; i < 1000; ++i) {
+    n += !seg.hasPadByPosition(x(mt), y(mt));
+  }
+  BOOST_TEST(n > 0);
+}
+
+BOOST_DATA_TEST_CASE(ClosestPadOutsideTheEnvelopeIsTheSameAsWithABruteForceSearch,
+                     boost::unit_test::data::xrange(21), segType)
+{
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    std::mt19937 mt(seg.nofPads());
+    auto box = seg.bbox();
+    std::uniform_real_distribution<double> x{box.xmin() - 50, box.xmax() + 50};
+    std::uniform_real_distribution<double> y{box.ymin() - 50, box.ymax() + 50};
+    int n{0};
+    while (n < 100) {
+      double px = x(mt);
+      double py = y(mt);
+      if (px >= box.xmin() && px <= box.xmax() && py >= box.ymin() && py <= box.ymax()) {
+        continue;
+      }
+      ++n;
+      int paduid = seg.findClosestPad(px, py);
+      BOOST_REQUIRE(isValid(paduid));
+      BOOST_CHECK_CLOSE_FRACTION(squaredDistanceToPad(seg, paduid, px, py),
+                                 bruteForceClosestDistance(seg, px, py), 1E-6);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ClosestPadOfANaNIsInvalid)
+{
+  const Segmentation &seg = getSegmentation(0, true);
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  BOOST_TEST(!isValid(seg.findClosestPad(nan, 0.0)));
+  BOOST_TEST(!isValid(seg.findClosestPad(0.0, nan)));
+  BOOST_TEST(!isValid(seg.findClosestPad(std::numeric_limits<double>::infinity(), 0.0)));
+}
+
+BOOST_DATA_TEST_CASE(FirstPadAlongASegmentIsTheSameAsWithABruteForceSearch, boost::unit_test::data::xrange(21),
+                     segType)
+{
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    std::mt19937 mt(seg.nofPads());
+    auto box = seg.bbox();
+    std::uniform_real_distribution<double> x{box.xmin() - 20, box.xmax() + 20};
+    std::uniform_real_distribution<double> y{box.ymin() - 20, box.ymax() + 20};
+    std::uniform_real_distribution<double> d{-30, 30};
+    int crossing{0};
+    for (auto i = 0; i < 200; ++i) {
+      double px = x(mt);
+      double py = y(mt);
+      double dx = d(mt);
+      // horizontal and vertical segments as well
+      double dy = i % 10 == 0 ? 0.0 : d(mt);
+      if (i % 10 == 1) {
+        dx = 0.0;
+      }
+      int paduid = seg.findClosestPad(px, py, dx, dy);
+      double expected = bruteForceFirstEntry(seg, px, py, dx, dy);
+      if (expected < 0) {
+        BOOST_TEST(!isValid(paduid));
+        continue;
+      }
+      ++crossing;
+      BOOST_REQUIRE(isValid(paduid));
+      BOOST_TEST(std::abs(entry(seg, paduid, px, py, dx, dy) - expected) < 1E-6);
+    }
+    BOOST_TEST(crossing > 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SegmentMissingTheSegmentationGivesAnInvalidPad)
+{
+  const Segmentation &seg = getSegmentation(0, true);
+  auto box = seg.bbox();
+  // going away from the segmentation
+  BOOST_TEST(!isValid(seg.findClosestPad(box.xmax() + 1, box.ymax() + 1, 10.0, 10.0)));
+  // running along it, without touching it
+  BOOST_TEST(!isValid(seg.findClosestPad(box.xmin(), box.ymax() + 1, box.xmax() - box.xmin(), 0.0)));
+  // while a segment ending within a pad gives a pad
+  int paduid = seg.nofPads() / 2;
+  BOOST_TEST(isValid(seg.findClosestPad(box.xmin() - 10, seg.padPositionY(paduid),
+                                        seg.padPositionX(paduid) - box.xmin() + 10, 0.0)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
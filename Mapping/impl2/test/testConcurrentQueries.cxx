@@ -0,0 +1,125 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "segmentationCreator.h"
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+
+namespace {
+
+constexpr int NofThreads{8};
+
+// segTypes no generated creator uses, registered (below) with creators
+// building the segmentations of segTypes 0..20, so those are not in
+// the cache yet when the threads start
+constexpr int FirstTestSegType{2000};
+
+template<int SEGTYPE>
+Segmentation *createCopy(bool isBendingPlane)
+{
+  return getSegmentationCreator(SEGTYPE)(isBendingPlane);
+}
+
+template<int... SEGTYPES>
+void registerCopies(std::integer_sequence<int, SEGTYPES...>)
+{
+  SegmentationCreator creators[] = {createCopy<SEGTYPES>...};
+  for (auto segType = 0; segType < sizeof...(SEGTYPES); ++segType) {
+    registerSegmentationCreator(FirstTestSegType + segType, creators[segType]);
+  }
+}
+
+/// What a thread gets from the segmentations : their addresses and the
+/// answers to a few position, FEE and area queries
+struct Answers
+{
+    std::vector<const Segmentation *> segmentations;
+    std::vector<int> paduids;
+
+    bool operator==(const Answers &other) const
+    { return segmentations == other.segmentations && paduids == other.paduids; }
+};
+
+Answers query(int firstSegType)
+{
+  Answers answers;
+  for (auto segType = firstSegType; segType < firstSegType + 21; ++segType) {
+    for (auto isBendingPlane: {true, false}) {
+      const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+      answers.segmentations.push_back(&seg);
+      std::mt19937 mt(segType - firstSegType);
+      auto box = seg.bbox();
+      std::uniform_real_distribution<double> x{box.xmin(), box.xmax()};
+      std::uniform_real_distribution<double> y{box.ymin(), box.ymax()};
+      for (auto i = 0; i < 100; ++i) {
+        double px = x(mt);
+        double py = y(mt);
+        answers.paduids.push_back(seg.findPadByPosition(px, py));
+        seg.forEachPadInArea(px, py, px + 2, py + 2, [&answers](int paduid) { answers.paduids.push_back(paduid); });
+      }
+      for (auto dualSampaId: seg.dualSampaIds()) {
+        answers.paduids.push_back(seg.findPadByFEE(dualSampaId, dualSampaId % 64));
+      }
+    }
+  }
+  return answers;
+}
+
+std::vector<Answers> queryFromThreads(int firstSegType)
+{
+  std::vector<Answers> answers(NofThreads);
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < NofThreads; ++i) {
+    threads.emplace_back([&answers, i, firstSegType]() { answers[i] = query(firstSegType); });
+  }
+  for (auto &t: threads) {
+    t.join();
+  }
+  return answers;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(concurrent_queries)
+
+BOOST_AUTO_TEST_CASE(ThreadsCreatingTheSegmentationsGetTheSameObjectsAndAnswers)
+{
+  registerCopies(std::make_integer_sequence<int, 21>{});
+  auto answers = queryFromThreads(FirstTestSegType);
+  for (auto &a: answers) {
+    BOOST_TEST((a == answers[0]));
+  }
+  // and the same answers as the segmentations created on a single thread
+  auto expected = query(0);
+  BOOST_TEST(answers[0].paduids == expected.paduids);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadsQueryingTheSameSegmentationsGetTheSameAnswers)
+{
+  auto expected = query(0);
+  for (auto &a: queryFromThreads(0)) {
+    BOOST_TEST((a == expected));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,68 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/monomorphic/generators/xrange.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "detectionElementCatalogue.h"
+#include "segmentationCreator.h"
+
+using namespace o2::mch::mapping::impl2;
+
+static_assert(detElemId2SegType(100) == 0, "");
+static_assert(detElemId2SegType(300) == 1, "");
+static_assert(detElemId2SegType(905) == 20, "");
+static_assert(detElemId2SegType(518) == -1, "");
+static_assert(detElemId2SegType(-100) == -1, "");
+static_assert(detElemIndex(726) == -1, "");
+static_assert(&detectionElements == &o2::mch::mapping::detectionElements, "the catalogue is shared by the implementations");
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(detection_element_catalogue)
+
+BOOST_DATA_TEST_CASE(DetElemIndexIsTheIndexInTheCatalogue, boost::unit_test::data::xrange(NofDetectionElements),
+                     deIndex)
+{
+  const auto &de = detectionElements[deIndex];
+  BOOST_TEST(detElemIndex(de.detElemId) == deIndex);
+  BOOST_TEST(de.chamberId == de.detElemId / 100);
+}
+
+BOOST_AUTO_TEST_CASE(DetElemIndexIsMinusOneForInvalidDetElemId)
+{
+  for (auto detElemId: {-1, 0, 99, 104, 518, 726, 1026, 1100}) {
+    BOOST_TEST(detElemIndex(detElemId) == -1);
+  }
+}
+
+BOOST_DATA_TEST_CASE(CountsMatchTheSegmentations, boost::unit_test::data::xrange(NofDetectionElements), deIndex)
+{
+  const auto &de = detectionElements[deIndex];
+  const Segmentation &b = getSegmentation(de.segType, true);
+  const Segmentation &nb = getSegmentation(de.segType, false);
+  BOOST_TEST(de.nofBendingPads == b.nofPads());
+  BOOST_TEST(de.nofNonBendingPads == nb.nofPads());
+  BOOST_TEST(de.nofBendingDualSampas == b.dualSampaIds().size());
+  BOOST_TEST(de.nofNonBendingDualSampas == nb.dualSampaIds().size());
+}
+
+BOOST_DATA_TEST_CASE(OneDetElemIdPerSegTypeHasThatSegType, boost::unit_test::data::xrange(NofSegTypes), segType)
+{
+  BOOST_TEST(detElemId2SegType(segType2DetElemId[segType]) == segType);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,59 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "segmentationCInterface.h"
+#include <vector>
+
+// this test is linked against a library built (see CMakeLists.txt)
+// for the detection elements 100 and 500 only, i.e. for segtypes 0 and 2
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(flp_library)
+
+BOOST_AUTO_TEST_CASE(OnlyDetectionElementsOfTheLibrarySegTypesAreListed)
+{
+  std::vector<int> detElemIds;
+  mchSegmentationForEachDetectionElement([](void *data, int detElemId) {
+    static_cast<std::vector<int> *>(data)->push_back(detElemId);
+  }, &detElemIds);
+  std::vector<int> expected{100, 101, 102, 103, 200, 201, 202, 203, 500, 509};
+  BOOST_TEST(detElemIds == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(OneDetectionElementPerSegTypeOfTheLibrary)
+{
+  std::vector<int> detElemIds;
+  mchSegmentationForOneDetectionElementOfEachSegmentationType([](void *data, int detElemId) {
+    static_cast<std::vector<int> *>(data)->push_back(detElemId);
+  }, &detElemIds);
+  std::vector<int> expected{100, 500};
+  BOOST_TEST(detElemIds == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(SegmentationsOfOtherSegTypesAreNotAvailable)
+{
+  for (auto isBendingPlane: {true, false}) {
+    BOOST_TEST(mchSegmentationConstruct(101, isBendingPlane) != nullptr);
+    BOOST_TEST(mchSegmentationConstruct(509, isBendingPlane) != nullptr);
+    BOOST_TEST(mchSegmentationConstruct(300, isBendingPlane) == nullptr);
+    BOOST_TEST(mchSegmentationConstruct(1025, isBendingPlane) == nullptr);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,60 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/monomorphic/generators/xrange.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "segmentationCreator.h"
+
+using namespace o2::mch::mapping;
+using namespace o2::mch::mapping::impl2;
+
+namespace {
+std::size_t bytes(const MemoryUsage &usage, const std::string &member)
+{
+  for (auto &m: usage) {
+    if (m.first == member) {
+      return m.second;
+    }
+  }
+  return 0;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(memory_usage)
+
+BOOST_DATA_TEST_CASE(PerPadTablesAreAccountedFor, boost::unit_test::data::xrange(21), segType)
+{
+  const Segmentation &seg = getSegmentation(segType, true);
+  auto usage = seg.memoryUsage();
+  BOOST_TEST(usage.front().first == "object");
+  BOOST_TEST(bytes(usage, "object") == sizeof(Segmentation));
+  BOOST_TEST(bytes(usage, "padPositionX") >= seg.nofPads() * sizeof(double));
+  BOOST_TEST(bytes(usage, "padDualSampaIds") >= seg.nofPads() * sizeof(int));
+  BOOST_TEST(totalMemoryUsage(usage) > bytes(usage, "padPositionX") + bytes(usage, "padPositionY"));
+}
+
+BOOST_DATA_TEST_CASE(FloatSegmentationHasSmallerPositionTables, boost::unit_test::data::xrange(21), segType)
+{
+  const Segmentation &seg = getSegmentation(segType, false);
+  SegmentationT<float> fseg{seg};
+  BOOST_TEST(2 * bytes(fseg.memoryUsage(), "padPositionX") == bytes(seg.memoryUsage(), "padPositionX"));
+  BOOST_TEST(totalMemoryUsage(fseg.memoryUsage()) < totalMemoryUsage(seg.memoryUsage()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,126 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/monomorphic/generators/xrange.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "padArray.h"
+#include "segmentationCreator.h"
+#include <algorithm>
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+
+namespace {
+
+struct Neighbours
+{
+    std::vector<int> edges;
+    std::vector<int> corners;
+};
+
+/// Neighbours of each pad, by a loop over all the pairs of pads :
+/// two pads are neighbours if they touch within 1 micron, by an edge
+/// if their projections on one axis overlap (by more than 1 micron),
+/// by a corner otherwise
+PadArray<Neighbours> bruteForceNeighbours(const Segmentation &seg)
+{
+  const double epsilon{1E-4};
+  PadArray<Neighbours> neighbours(seg);
+  for (auto i = 0; i < seg.nofPads(); ++i) {
+    for (auto j = 0; j < seg.nofPads(); ++j) {
+      if (i == j) {
+        continue;
+      }
+      double overlapX = (seg.padSizeX(i) + seg.padSizeX(j)) / 2.0 - std::abs(seg.padPositionX(i) - seg.padPositionX(j));
+      double overlapY = (seg.padSizeY(i) + seg.padSizeY(j)) / 2.0 - std::abs(seg.padPositionY(i) - seg.padPositionY(j));
+      if (overlapX < -epsilon || overlapY < -epsilon) {
+        continue;
+      }
+      if (overlapX > epsilon || overlapY > epsilon) {
+        neighbours[i].edges.push_back(j);
+      } else {
+        neighbours[i].corners.push_back(j);
+      }
+    }
+  }
+  return neighbours;
+}
+
+std::vector<int> sorted(gsl::span<const int> s)
+{
+  std::vector<int> v(s.begin(), s.end());
+  std::sort(v.begin(), v.end());
+  return v;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(neighbours)
+
+BOOST_DATA_TEST_CASE(NeighboursAreTheSameAsWithABruteForceSearch, boost::unit_test::data::xrange(21), segType)
+{
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    auto expected = bruteForceNeighbours(seg);
+    for (auto paduid = 0; paduid < seg.nofPads(); ++paduid) {
+      auto edges = sorted(seg.getEdgeNeighbours(paduid));
+      BOOST_CHECK_EQUAL_COLLECTIONS(edges.begin(), edges.end(),
+                                    expected[paduid].edges.begin(), expected[paduid].edges.end());
+      // the edge neighbours come first, then the corner ones
+      auto all = seg.getNeighbours(paduid);
+      BOOST_REQUIRE_GE(all.size(), edges.size());
+      auto corners = sorted(all.subspan(edges.size(), all.size() - edges.size()));
+      BOOST_CHECK_EQUAL_COLLECTIONS(corners.begin(), corners.end(),
+                                    expected[paduid].corners.begin(), expected[paduid].corners.end());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NeighboursCrossPadGroupsAndPadSizes)
+{
+  // segmentation type 0 (station 1 quadrant) has 4 pad sizes, so the
+  // brute force comparison above covers pads with neighbours of other
+  // sizes and in other pad groups (hence of other dual sampas), touching
+  // by an edge or by a corner
+  const Segmentation &seg = getSegmentation(0, true);
+  int otherSize{0};
+  int otherDualSampa{0};
+  int corners{0};
+  for (auto paduid = 0; paduid < seg.nofPads(); ++paduid) {
+    auto edges = seg.getEdgeNeighbours(paduid);
+    auto all = seg.getNeighbours(paduid);
+    corners += all.size() - edges.size();
+    for (auto n: all) {
+      otherSize += seg.padSizeX(n) != seg.padSizeX(paduid) || seg.padSizeY(n) != seg.padSizeY(paduid);
+      otherDualSampa += seg.padDualSampaId(n) != seg.padDualSampaId(paduid);
+    }
+  }
+  BOOST_TEST(otherSize > 0);
+  BOOST_TEST(otherDualSampa > 0);
+  BOOST_TEST(corners > 0);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidPadHasNoNeighbours)
+{
+  const Segmentation &seg = getSegmentation(0, true);
+  BOOST_TEST(seg.getNeighbours(-1).empty());
+  BOOST_TEST(seg.getNeighbours(seg.nofPads()).empty());
+  BOOST_TEST(seg.getEdgeNeighbours(seg.nofPads()).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/monomorphic/generators/xrange.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "padArray.h"
+#include "segmentationCreator.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(pad_array)
+
+BOOST_DATA_TEST_CASE(OneValuePerPad, boost::unit_test::data::xrange(21), segType)
+{
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    PadArray<float> charges(seg);
+    BOOST_TEST(charges.size() == seg.nofPads());
+    BOOST_TEST(charges.values().size() == seg.nofPads());
+    BOOST_TEST(std::count(charges.begin(), charges.end(), 0.0f) == seg.nofPads());
+
+    // works as well for a float segmentation
+    SegmentationT<float> fseg{seg};
+    BOOST_TEST(PadArray<int>(fseg, 42).size() == seg.nofPads());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ValuesAreAssignedAndFilledByPaduid)
+{
+  const Segmentation &seg = getSegmentation(0, true);
+  PadArray<int> counts(seg, 1);
+  BOOST_TEST(std::count(counts.begin(), counts.end(), 1) == seg.nofPads());
+
+  for (auto paduid = 0; paduid < seg.nofPads(); paduid += 3) {
+    counts[paduid] = paduid;
+  }
+  counts.at(1) = -1;
+  for (auto paduid = 0; paduid < seg.nofPads(); ++paduid) {
+    int expected = paduid % 3 == 0 ? paduid : (paduid == 1 ? -1 : 1);
+    BOOST_TEST(counts[paduid] == expected);
+    BOOST_TEST(counts.at(paduid) == expected);
+  }
+
+  counts.fill();
+  BOOST_TEST(std::count(counts.begin(), counts.end(), 0) == seg.nofPads());
+  counts.fill(7);
+  BOOST_TEST(std::count(counts.begin(), counts.end(), 7) == seg.nofPads());
+}
+
+BOOST_AUTO_TEST_CASE(AtThrowsForAnInvalidPaduid)
+{
+  const Segmentation &seg = getSegmentation(0, true);
+  PadArray<double> values(seg);
+  const PadArray<double> &constValues = values;
+  BOOST_CHECK_NO_THROW(values.at(0));
+  BOOST_CHECK_NO_THROW(values.at(seg.nofPads() - 1));
+  BOOST_CHECK_THROW(values.at(-1), std::out_of_range);
+  BOOST_CHECK_THROW(values.at(seg.nofPads()), std::out_of_range);
+  BOOST_CHECK_THROW(constValues.at(Segmentation::InvalidPadUid), std::out_of_range);
+  BOOST_CHECK_THROW(constValues.at(seg.nofPads()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(ForEachVisitsThePadsInPaduidOrder)
+{
+  const Segmentation &seg = getSegmentation(5, false);
+  PadArray<int> dualSampaIds(seg);
+  for (auto paduid = 0; paduid < seg.nofPads(); ++paduid) {
+    dualSampaIds[paduid] = seg.padDualSampaId(paduid);
+  }
+  std::vector<int> paduids;
+  dualSampaIds.forEach([&](int paduid, int dualSampaId) {
+    paduids.push_back(paduid);
+    BOOST_TEST(dualSampaId == seg.padDualSampaId(paduid));
+  });
+  std::vector<int> expected(seg.nofPads());
+  std::iota(expected.begin(), expected.end(), 0);
+  BOOST_TEST(paduids == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
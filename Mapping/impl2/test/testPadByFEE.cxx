@@ -0,0 +1,89 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/monomorphic/generators/xrange.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "segmentationCreator.h"
+#include <algorithm>
+#include <map>
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+
+namespace {
+
+/// The paduids of each dual sampa, by a loop over all the pads
+std::map<int, std::vector<int>> bruteForcePadUids(const Segmentation &seg)
+{
+  std::map<int, std::vector<int>> padUids;
+  for (auto paduid = 0; paduid < seg.nofPads(); ++paduid) {
+    padUids[seg.padDualSampaId(paduid)].push_back(paduid);
+  }
+  return padUids;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(pad_by_fee)
+
+BOOST_DATA_TEST_CASE(FEETablesGiveTheSamePadsAsABruteForceSearch, boost::unit_test::data::xrange(21), segType)
+{
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    auto expected = bruteForcePadUids(seg);
+
+    std::vector<int> dualSampaIds;
+    for (auto &e: expected) {
+      dualSampaIds.push_back(e.first);
+    }
+    BOOST_TEST(std::vector<int>(seg.dualSampaIds().begin(), seg.dualSampaIds().end()) == dualSampaIds);
+
+    for (auto &e: expected) {
+      int dualSampaId = e.first;
+      auto padUids = seg.getPadUids(dualSampaId);
+      std::vector<int> sorted(padUids.begin(), padUids.end());
+      std::sort(sorted.begin(), sorted.end());
+      BOOST_TEST(sorted == e.second);
+
+      // each channel gives the pad connected to it, if any
+      for (auto channel = 0; channel < Segmentation::NofDualSampaChannels; ++channel) {
+        auto it = std::find_if(e.second.begin(), e.second.end(),
+                               [&seg, channel](int paduid) { return seg.padDualSampaChannel(paduid) == channel; });
+        int paduid = it != e.second.end() ? *it : Segmentation::InvalidPadUid;
+        BOOST_TEST(seg.findPadByFEE(dualSampaId, channel) == paduid);
+      }
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(UnknownFEEsHaveNoPad, boost::unit_test::data::xrange(21), segType)
+{
+  const Segmentation &seg = getSegmentation(segType, true);
+  int dualSampaId = *seg.dualSampaIds().begin();
+  BOOST_TEST(seg.findPadByFEE(dualSampaId, -1) == Segmentation::InvalidPadUid);
+  BOOST_TEST(seg.findPadByFEE(dualSampaId, Segmentation::NofDualSampaChannels) == Segmentation::InvalidPadUid);
+  for (auto unknown: {-1, 0, *seg.dualSampaIds().rbegin() + 1, 1 << 20}) {
+    if (seg.dualSampaIds().count(unknown)) {
+      continue;
+    }
+    BOOST_TEST(seg.findPadByFEE(unknown, 0) == Segmentation::InvalidPadUid);
+    BOOST_TEST(seg.getPadUids(unknown).empty());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,108 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+#include "segmentationCInterfaceExt.h"
+#include "segmentationCreator.h"
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+
+namespace {
+
+/// Random positions around the segmentation, plus positions
+/// far away from it, infinite or NaN
+template<typename T>
+void testPositions(const Segmentation &seg, std::vector<T> &x, std::vector<T> &y)
+{
+  std::mt19937 mt(seg.nofPads());
+  auto box = seg.bbox();
+  std::uniform_real_distribution<double> px{box.xmin() - 10, box.xmax() + 10};
+  std::uniform_real_distribution<double> py{box.ymin() - 10, box.ymax() + 10};
+  for (auto i = 0; i < 1000; ++i) {
+    x.push_back(px(mt));
+    y.push_back(py(mt));
+  }
+  const T nan = std::numeric_limits<T>::quiet_NaN();
+  const T inf = std::numeric_limits<T>::infinity();
+  const T big = std::numeric_limits<T>::max();
+  for (T v: {T{1E10}, T{-1E10}, T{1E30}, big, -big, inf, -inf, nan}) {
+    x.push_back(v);
+    y.push_back(x[0]);
+    x.push_back(x[1]);
+    y.push_back(v);
+    x.push_back(v);
+    y.push_back(v);
+  }
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(pad_by_positions)
+
+typedef boost::mpl::list<float, double> test_types;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedAndPointByPointSearchesGiveTheSamePads, T, test_types)
+{
+  for (auto segType = 0; segType < 21; ++segType) {
+    for (auto isBendingPlane : {true, false}) {
+      const Segmentation &dseg = getSegmentation(segType, isBendingPlane);
+      SegmentationT<T> seg{dseg};
+      std::vector<T> x;
+      std::vector<T> y;
+      testPositions(dseg, x, y);
+      std::vector<int> paduids(x.size());
+      seg.findPadByPositions(x, y, paduids);
+      int nofPads{0};
+      for (auto i = 0; i < x.size(); ++i) {
+        BOOST_CHECK_EQUAL(paduids[i], seg.findPadByPosition(x[i], y[i]));
+        nofPads += paduids[i] != Segmentation::InvalidPadUid;
+      }
+      BOOST_TEST(nofPads > 0);
+      // the far away, infinite or NaN positions have no pad
+      BOOST_TEST(std::count(paduids.begin() + 1000, paduids.end(), Segmentation::InvalidPadUid) == x.size() - 1000);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MismatchingSizesAreRejected)
+{
+  const Segmentation &seg = getSegmentation(0, true);
+  std::vector<double> x(10);
+  std::vector<double> y(9);
+  std::vector<int> paduids(10);
+  BOOST_CHECK_THROW(seg.findPadByPositions(x, y, paduids), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(CInterfaceIgnoresANegativeNumberOfPositions)
+{
+  auto handle = mchSegmentationConstruct(100, true);
+  BOOST_REQUIRE(handle != nullptr);
+  double x{0.0};
+  double y{0.0};
+  int paduid{42};
+  mchSegmentationFindPadByPositions(handle, -1, &x, &y, &paduid);
+  mchSegmentationFindPadByPositions(handle, 0, &x, &y, &paduid);
+  BOOST_TEST(paduid == 42);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,104 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "padGroupType.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+
+namespace {
+
+/// Ids of a nx*ny pad group type, about a quarter of the cells having no pad
+/// (as for the generated pad group types, the ids are a permutation of 0..nofPads-1)
+std::vector<int> randomIds(int nx, int ny, std::mt19937 &mt)
+{
+  std::vector<int> ids(nx * ny);
+  std::iota(ids.begin(), ids.end(), 0);
+  std::shuffle(ids.begin(), ids.end(), mt);
+  int nofPads = std::max(1, 3 * nx * ny / 4);
+  for (auto &id: ids) {
+    if (id >= nofPads) {
+      id = -1;
+    }
+  }
+  return ids;
+}
+
+/// Compare the accessors of pgt with a linear scan of its ids
+void checkAgainstIds(const PadGroupType &pgt, const std::vector<int> &ids)
+{
+  const int nx = pgt.getNofPadsX();
+  std::vector<int> fastIndices;
+  for (auto fastIndex = 0; fastIndex < ids.size(); ++fastIndex) {
+    bool exists = ids[fastIndex] >= 0;
+    int ix = fastIndex % nx;
+    int iy = fastIndex / nx;
+    BOOST_TEST(pgt.fastIndex(ix, iy) == fastIndex);
+    BOOST_TEST(pgt.hasPad(fastIndex) == exists);
+    BOOST_TEST(pgt.hasPad(ix, iy) == exists);
+    BOOST_TEST(pgt.id(fastIndex) == ids[fastIndex]);
+    BOOST_TEST(pgt.padIndex(fastIndex) == (exists ? static_cast<int>(fastIndices.size()) : -1));
+    if (exists) {
+      fastIndices.push_back(fastIndex);
+    }
+  }
+  BOOST_TEST(pgt.getNofPads() == fastIndices.size());
+  auto fi = pgt.fastIndices();
+  BOOST_TEST(std::vector<int>(fi.begin(), fi.end()) == fastIndices);
+
+  for (auto id = -1; id <= static_cast<int>(ids.size()); ++id) {
+    auto it = std::find(ids.begin(), ids.end(), id);
+    int expected = id >= 0 && it != ids.end() ? static_cast<int>(it - ids.begin()) : -1;
+    BOOST_TEST(pgt.fastIndexById(id) == expected);
+    BOOST_TEST(pgt.hasPadById(id) == (expected >= 0));
+  }
+
+  // out of range indices have no pad
+  BOOST_TEST(!pgt.hasPad(-1));
+  BOOST_TEST(!pgt.hasPad(static_cast<int>(ids.size())));
+  BOOST_TEST(!pgt.hasPad(-1, 0));
+  BOOST_TEST(!pgt.hasPad(nx, 0));
+  BOOST_TEST(!pgt.hasPad(0, pgt.getNofPadsY()));
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(pad_group_type)
+
+BOOST_AUTO_TEST_CASE(AccessorsGiveTheSameResultsAsALinearScanOfTheIds)
+{
+  std::mt19937 mt(42);
+  // including types spanning several 64 bits occupancy words
+  for (auto size: std::vector<std::pair<int, int>>{{1, 1}, {3, 2}, {8, 8}, {12, 7}, {16, 9}, {40, 2}}) {
+    auto ids = randomIds(size.first, size.second, mt);
+    checkAgainstIds(PadGroupType(size.first, size.second, ids), ids);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConstructorThrowsIfTheNumberOfIdsIsNotTheNumberOfCells)
+{
+  BOOST_CHECK_THROW(PadGroupType(3, 2, {0, 1, 2, 3, 4}), std::invalid_argument);
+  BOOST_CHECK_THROW(PadGroupType(3, 2, {0, 1, 2, 3, 4, 5, 6}), std::invalid_argument);
+  BOOST_CHECK_NO_THROW(PadGroupType(3, 2, {0, 1, 2, 3, 4, -1}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/monomorphic/generators/xrange.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "segmentationCreator.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+
+namespace {
+
+struct Area
+{
+    double xmin, ymin, xmax, ymax;
+};
+
+/// Pads whose surface (without its edges), shrunk by margin on each side,
+/// intersects the area, by a loop over all the pads
+std::vector<int> bruteForcePadsInArea(const Segmentation &seg, const Area &area, double margin)
+{
+  std::vector<int> paduids;
+  for (auto paduid = 0; paduid < seg.nofPads(); ++paduid) {
+    double dx = seg.padSizeX(paduid) / 2.0 - margin;
+    double dy = seg.padSizeY(paduid) / 2.0 - margin;
+    if (seg.padPositionX(paduid) + dx > area.xmin && seg.padPositionX(paduid) - dx < area.xmax &&
+        seg.padPositionY(paduid) + dy > area.ymin && seg.padPositionY(paduid) - dy < area.ymax) {
+      paduids.push_back(paduid);
+    }
+  }
+  return paduids;
+}
+
+std::vector<int> padsInArea(const Segmentation &seg, const Area &area)
+{
+  std::vector<int> paduids;
+  seg.forEachPadInArea(area.xmin, area.ymin, area.xmax, area.ymax,
+                       [&paduids](int paduid) { paduids.push_back(paduid); });
+  std::sort(paduids.begin(), paduids.end());
+  return paduids;
+}
+
+/// Areas of all sizes (including zero width and/or height ones) at random
+/// positions, and areas whose borders are on pad centers, so the pads
+/// along their borders are straddling them
+std::vector<Area> testAreas(const Segmentation &seg)
+{
+  std::mt19937 mt(seg.nofPads());
+  auto box = seg.bbox();
+  std::uniform_real_distribution<double> x{box.xmin() - 5, box.xmax() + 5};
+  std::uniform_real_distribution<double> y{box.ymin() - 5, box.ymax() + 5};
+  std::uniform_real_distribution<double> size{0, 30};
+  std::uniform_int_distribution<int> pad{0, seg.nofPads() - 1};
+  std::vector<Area> areas;
+  for (auto i = 0; i < 50; ++i) {
+    double x0 = x(mt);
+    double y0 = y(mt);
+    areas.push_back({x0, y0, x0 + size(mt), y0 + size(mt)});
+    areas.push_back({x0, y0, x0, y0 + size(mt)});
+    areas.push_back({x0, y0, x0 + size(mt), y0});
+    areas.push_back({x0, y0, x0, y0});
+    int p1 = pad(mt);
+    int p2 = pad(mt);
+    areas.push_back({std::min(seg.padPositionX(p1), seg.padPositionX(p2)),
+                     std::min(seg.padPositionY(p1), seg.padPositionY(p2)),
+                     std::max(seg.padPositionX(p1), seg.padPositionX(p2)),
+                     std::max(seg.padPositionY(p1), seg.padPositionY(p2))});
+  }
+  return areas;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(pad_in_area)
+
+BOOST_DATA_TEST_CASE(ForEachPadInAreaGivesTheSamePadsAsABruteForceSearch, boost::unit_test::data::xrange(21), segType)
+{
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    for (auto &area: testAreas(seg)) {
+      auto paduids = padsInArea(seg, area);
+      BOOST_TEST((std::adjacent_find(paduids.begin(), paduids.end()) == paduids.end()));
+      // the pads surely within the area must be visited, and the visited ones
+      // must at least touch the area (pad edges can be, within rounding errors,
+      // right on the area borders, e.g. for areas from pad centers, as pad sizes
+      // are multiple of each other)
+      auto sure = bruteForcePadsInArea(seg, area, 1E-6);
+      auto possible = bruteForcePadsInArea(seg, area, -1E-6);
+      BOOST_TEST(std::includes(paduids.begin(), paduids.end(), sure.begin(), sure.end()));
+      BOOST_TEST(std::includes(possible.begin(), possible.end(), paduids.begin(), paduids.end()));
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(PadsOnlyTouchingTheAreaAreNotVisited, boost::unit_test::data::xrange(21), segType)
+{
+  const Segmentation &seg = getSegmentation(segType, true);
+  for (auto paduid = 0; paduid < seg.nofPads(); paduid += 97) {
+    double dx = seg.padSizeX(paduid) / 2.0;
+    double dy = seg.padSizeY(paduid) / 2.0;
+    double x = seg.padPositionX(paduid);
+    double y = seg.padPositionY(paduid);
+    // thin areas along the outside of the four pad edges
+    for (auto &area: std::vector<Area>{{x + dx + 1E-6, y - dy, x + dx + 1E-3, y + dy},
+                                       {x - dx - 1E-3, y - dy, x - dx - 1E-6, y + dy},
+                                       {x - dx, y + dy + 1E-6, x + dx, y + dy + 1E-3},
+                                       {x - dx, y - dy - 1E-3, x + dx, y - dy - 1E-6}}) {
+      auto paduids = padsInArea(seg, area);
+      BOOST_TEST(std::count(paduids.begin(), paduids.end(), paduid) == 0);
+    }
+    // while a point within the pad gives (only) that pad
+    auto paduids = padsInArea(seg, {x, y, x, y});
+    BOOST_TEST(paduids == std::vector<int>{paduid});
+  }
+}
+
+BOOST_AUTO_TEST_CASE(InvertedAreaHasNoPad)
+{
+  const Segmentation &seg = getSegmentation(0, true);
+  auto box = seg.bbox();
+  BOOST_TEST(padsInArea(seg, {box.xmax(), box.ymax(), box.xmin(), box.ymin()}).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
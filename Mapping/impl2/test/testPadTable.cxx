@@ -0,0 +1,86 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/monomorphic/generators/xrange.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "segmentationCreator.h"
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(pad_table)
+
+BOOST_DATA_TEST_CASE(PadTableIsConsistentWithThePositionAndFEELookups, boost::unit_test::data::xrange(21), segType)
+{
+  // the position lookup decodes (x,y) into a pad group and a pad within
+  // it, while the FEE lookup uses the dual sampa tables, so both are
+  // independent of the pad table
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    auto box = seg.bbox();
+    for (auto paduid = 0; paduid < seg.nofPads(); ++paduid) {
+      double x = seg.padPositionX(paduid);
+      double y = seg.padPositionY(paduid);
+      BOOST_TEST(seg.findPadByPosition(x, y) == paduid);
+      BOOST_TEST(seg.findPadByFEE(seg.padDualSampaId(paduid), seg.padDualSampaChannel(paduid)) == paduid);
+      BOOST_TEST(seg.padSizeX(paduid) > 0);
+      BOOST_TEST(seg.padSizeY(paduid) > 0);
+      BOOST_TEST(x - seg.padSizeX(paduid) / 2 >= box.xmin());
+      BOOST_TEST(x + seg.padSizeX(paduid) / 2 <= box.xmax());
+      BOOST_TEST(y - seg.padSizeY(paduid) / 2 >= box.ymin());
+      BOOST_TEST(y + seg.padSizeY(paduid) / 2 <= box.ymax());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PadTableIsTheDecodingOfThePadGroups)
+{
+  // a 3x2 pad group type without its top right pad :
+  //   3  4  .
+  //   0  1  2
+  // (the numbers being the dual sampa channels)
+  std::vector<PadGroupType> padGroupTypes{PadGroupType(3, 2, {0, 1, 2, 3, 4, -1})};
+  std::vector<std::pair<float, float>> padSizes{{1.0, 0.5}, {2.0, 0.5}};
+  std::vector<PadGroup> padGroups{{7, 0, 0, 10.0, 20.0}, {9, 0, 1, 13.0, 20.0}};
+
+  Segmentation seg{0, true, padGroups, padGroupTypes, padSizes};
+  BOOST_REQUIRE(seg.nofPads() == 10);
+
+  // paduids are dense, pad group after pad group, in fastIndex order within a pad group
+  int paduid{0};
+  for (auto &pg: padGroups) {
+    auto &pgt = padGroupTypes[pg.mPadGroupTypeId];
+    auto &size = padSizes[pg.mPadSizeId];
+    for (auto fastIndex = 0; fastIndex < pgt.getNofPadsX() * pgt.getNofPadsY(); ++fastIndex) {
+      if (pgt.id(fastIndex) < 0) {
+        continue;
+      }
+      BOOST_TEST(seg.padPositionX(paduid) == pg.mX + (pgt.ix(fastIndex) + 0.5) * size.first);
+      BOOST_TEST(seg.padPositionY(paduid) == pg.mY + (pgt.iy(fastIndex) + 0.5) * size.second);
+      BOOST_TEST(seg.padSizeX(paduid) == size.first);
+      BOOST_TEST(seg.padSizeY(paduid) == size.second);
+      BOOST_TEST(seg.padDualSampaId(paduid) == pg.mFECId);
+      BOOST_TEST(seg.padDualSampaChannel(paduid) == pgt.id(fastIndex));
+      ++paduid;
+    }
+  }
+  BOOST_TEST(paduid == seg.nofPads());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
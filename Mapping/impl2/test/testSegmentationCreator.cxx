@@ -0,0 +1,70 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include "segmentationCInterface.h"
+#include "segmentationCreator.h"
+#include <stdexcept>
+
+using namespace o2::mch::mapping::impl2;
+
+namespace {
+
+// a segType no generated creator uses
+constexpr int LateSegType{1000};
+
+Segmentation *createLateSegType(bool isBendingPlane)
+{
+  return getSegmentationCreator(0)(isBendingPlane);
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(segmentation_creator)
+
+BOOST_AUTO_TEST_CASE(UnknownSegTypeThrows)
+{
+  BOOST_CHECK_THROW(getSegmentation(-1, true), std::out_of_range);
+  BOOST_CHECK_THROW(getSegmentation(LateSegType + 1, false), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(CreatorRegisteredAfterFirstUseIsFound)
+{
+  // make sure the cache is in use before the registration
+  const Segmentation &seg = getSegmentation(0, true);
+  BOOST_CHECK_THROW(getSegmentation(LateSegType, true), std::out_of_range);
+
+  registerSegmentationCreator(LateSegType, createLateSegType);
+
+  for (auto isBendingPlane: {true, false}) {
+    const Segmentation &late = getSegmentation(LateSegType, isBendingPlane);
+    BOOST_TEST(late.nofPads() == getSegmentation(0, isBendingPlane).nofPads());
+    BOOST_TEST(&late == &getSegmentation(LateSegType, isBendingPlane));
+  }
+  BOOST_TEST(&seg == &getSegmentation(0, true));
+}
+
+BOOST_AUTO_TEST_CASE(CInterfaceGivesANullHandleForAnUnknownDetectionElement)
+{
+  for (auto isBendingPlane: {true, false}) {
+    BOOST_TEST(mchSegmentationConstruct(42, isBendingPlane) == nullptr);
+    BOOST_TEST(mchSegmentationConstruct(-1, isBendingPlane) == nullptr);
+    BOOST_TEST(mchSegmentationConstruct(100, isBendingPlane) != nullptr);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,105 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "segmentationCreator.h"
+#include "GenerateTestPoints.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace o2::mch::mapping::impl2;
+using o2::mch::mapping::generateTestPoints;
+
+namespace {
+
+constexpr int NTESTPOINTS{10000};
+
+// a float has about 7 significant digits, i.e. ~1 micron at 100 cm
+constexpr double PositionTolerance{1E-4};
+
+// points closer to a pad edge than this might legitimately be
+// attributed to a different pad in float and in double
+constexpr double EdgeTolerance{1E-3};
+
+template<typename T>
+bool isNearPadEdge(const SegmentationT<T> &seg, int paduid, double x, double y)
+{
+  if (paduid == SegmentationT<T>::InvalidPadUid) {
+    return true;
+  }
+  double dx = std::abs(x - seg.padPositionX(paduid)) - seg.padSizeX(paduid) / 2.0;
+  double dy = std::abs(y - seg.padPositionY(paduid)) - seg.padSizeY(paduid) / 2.0;
+  return std::abs(dx) < EdgeTolerance || std::abs(dy) < EdgeTolerance;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(o2_mch_mapping)
+BOOST_AUTO_TEST_SUITE(segmentation_float)
+
+BOOST_DATA_TEST_CASE(FloatAndDoublePadsAreTheSame, boost::unit_test::data::xrange(21), segType)
+{
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    SegmentationT<float> fseg{seg};
+
+    BOOST_REQUIRE_EQUAL(fseg.nofPads(), seg.nofPads());
+
+    for (auto paduid = 0; paduid < seg.nofPads(); ++paduid) {
+      BOOST_CHECK_SMALL(fseg.padPositionX(paduid) - seg.padPositionX(paduid), PositionTolerance);
+      BOOST_CHECK_SMALL(fseg.padPositionY(paduid) - seg.padPositionY(paduid), PositionTolerance);
+      BOOST_CHECK_EQUAL(fseg.padDualSampaId(paduid), seg.padDualSampaId(paduid));
+      BOOST_CHECK_EQUAL(fseg.padDualSampaChannel(paduid), seg.padDualSampaChannel(paduid));
+    }
+  }
+}
+
+BOOST_DATA_TEST_CASE(FloatAndDoubleFindPadByPositionAgree, boost::unit_test::data::xrange(21), segType)
+{
+  for (auto isBendingPlane : {true, false}) {
+    const Segmentation &seg = getSegmentation(segType, isBendingPlane);
+    SegmentationT<float> fseg{seg};
+
+    auto bbox = seg.bbox();
+    auto testPoints = generateTestPoints(NTESTPOINTS, bbox.xmin(), bbox.ymin(), bbox.xmax(), bbox.ymax(), 0);
+
+    std::vector<float> x;
+    std::vector<float> y;
+    for (const auto &tp: testPoints) {
+      x.push_back(tp.first);
+      y.push_back(tp.second);
+    }
+    std::vector<int> paduids(x.size());
+    fseg.findPadByPositions(x, y, paduids);
+
+    int nofMismatches{0};
+    for (auto i = 0; i < x.size(); ++i) {
+      // compare at the very same (float) position
+      int paduid = seg.findPadByPosition(x[i], y[i]);
+      BOOST_CHECK_EQUAL(paduids[i], fseg.findPadByPosition(x[i], y[i]));
+      if (paduids[i] != paduid) {
+        ++nofMismatches;
+        BOOST_CHECK(isNearPadEdge(seg, paduid, x[i], y[i]) && isNearPadEdge(fseg, paduids[i], x[i], y[i]));
+      }
+    }
+    BOOST_CHECK_LE(nofMismatches, NTESTPOINTS / 1000);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,83 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+/// Helpers to compute the memory used by the segmentations of
+/// the implementations in this repository.
+///
+/// The heap sizes are computed from the containers sizes (or capacities),
+/// and do not include the allocator overhead, so they are (slight)
+/// underestimates of the actual resident memory.
+
+#ifndef O2_MCH_MAPPING_MEMORYUSAGE_H
+#define O2_MCH_MAPPING_MEMORYUSAGE_H
+
+#include "contour.h"
+#include "polygon.h"
+#include <cstddef>
+#include <numeric>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace o2 {
+namespace mch {
+namespace mapping {
+
+/// Number of bytes used by an object, per member (in declaration order).
+/// The "object" entry is the sizeof of the object itself, the other ones
+/// being the memory its members own outside of it (i.e. on the heap).
+using MemoryUsage = std::vector<std::pair<std::string, std::size_t>>;
+
+inline std::size_t totalMemoryUsage(const MemoryUsage &usage)
+{
+  return std::accumulate(usage.begin(), usage.end(), std::size_t{0},
+                         [](std::size_t sum, const std::pair<std::string, std::size_t> &m) { return sum + m.second; });
+}
+
+template<typename T>
+std::size_t heapMemoryUsage(const std::vector<T> &v)
+{
+  return v.capacity() * sizeof(T);
+}
+
+/// Each element of a std::set is a red-black tree node, i.e. the element
+/// plus three pointers and a color (rounded up here to a fourth pointer)
+template<typename T>
+std::size_t heapMemoryUsage(const std::set<T> &s)
+{
+  return s.size() * (sizeof(T) + 4 * sizeof(void *));
+}
+
+template<typename T>
+std::size_t heapMemoryUsage(const o2::mch::contour::Polygon<T> &polygon)
+{
+  return polygon.size() * sizeof(o2::mch::contour::Vertex<T>);
+}
+
+template<typename T>
+std::size_t heapMemoryUsage(const o2::mch::contour::Contour<T> &contour)
+{
+  std::size_t n{0};
+  for (auto i = 0; i < contour.size(); ++i) {
+    n += sizeof(o2::mch::contour::Polygon<T>) + heapMemoryUsage(contour[i]);
+  }
+  return n;
+}
+
+}
+}
+}
+
+#endif
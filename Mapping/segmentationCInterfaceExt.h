@@ -0,0 +1,75 @@
+//
+// Copyright CERN and copyright holders of ALICE O2. This software is
+// distributed under the terms of the GNU General Public License v3 (GPL
+// Version 3), copied verbatim in the file "COPYING".
+//
+// See https://alice-o2.web.cern.ch/ for full licensing information.
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+///
+/// @author  Laurent Aphecetche
+
+/// Extensions to the core C interface of the mapping (segmentationCInterface.h),
+/// offered by the implementations in this repository.
+///
+/// Those are mostly bulk functions, so that clients pay the call overhead
+/// once per array instead of once per pad.
+///
+/// Not every implementation offers every function : check the exported
+/// symbols of the library in use.
+///
+/// The implementations in this repository also agree on the behaviour of
+/// some core functions where segmentationCInterface.h leaves it open :
+///
+/// - mchSegmentationForEachPadInDualSampa calls the handler for no pad
+///   if the dual sampa is not part of the segmentation (impl1 used to
+///   throw std::out_of_range through the C interface in that case)
+/// - mchSegmentationPadPositionX/Y, mchSegmentationPadSizeX/Y and
+///   mchSegmentationPadDualSampaId/Channel return NaN (for the positions
+///   and sizes) or -1 (for the dual sampa id and channel) for an invalid
+///   paduid, e.g. the one a lookup gives when there is no pad
+
+#ifndef O2_MCH_MAPPING_SEGMENTATIONCINTERFACEEXT_H
+#define O2_MCH_MAPPING_SEGMENTATIONCINTERFACEEXT_H
+
+#include "segmentationCInterface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Find the pads at the n positions (x[i],y[i]) and store their uids
+/// in paduids[i]. Positions without pad get an invalid paduid.
+/// Nothing is done if n is not positive.
+void mchSegmentationFindPadByPositions(MchSegmentationHandle segHandle, int n,
+                                       const double *x, const double *y, int *paduids);
+
+/// Call handler for each pad sharing an edge with the given pad.
+/// Contrary to mchSegmentationForEachNeighbouringPad, the pads
+/// touching the given one only by a corner are not considered.
+void mchSegmentationForEachEdgeNeighbouringPad(MchSegmentationHandle segHandle, int paduid,
+                                               MchPadHandler handler, void *userData);
+
+/// Find the pads connected to the n (dualSampaIds[i],dualSampaChannels[i])
+/// and store their uids in paduids[i].
+void mchSegmentationFindPadByFEEs(MchSegmentationHandle segHandle, int n,
+                                  const int *dualSampaIds, const int *dualSampaChannels, int *paduids);
+
+/// Fill the attributes of the n pads paduids[i] into the i-th element of
+/// the given arrays. Any of the output arrays can be NULL, in which case
+/// the corresponding attribute is not retrieved.
+/// An invalid paduids[i] gets the same values as from the per-pad functions,
+/// i.e. NaN positions and sizes, and -1 dual sampa id and channel.
+void mchSegmentationPadAttributes(MchSegmentationHandle segHandle, int n, const int *paduids,
+                                  double *positionX, double *positionY,
+                                  double *sizeX, double *sizeY,
+                                  int *dualSampaIds, int *dualSampaChannels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -30,9 +30,9 @@ std::ostream &operator<<(std::ostream &os, const MotifPosition &position)
      << position.mPadSizeId << "," << std::setprecision(10) << position.mPositionX << "," << position.mPositionY;
   if (position.hasTwoPadSizes()) {
     os << "," << position.mSecondPadSizeId << ", {";
-    for (auto i = 0; i < position.mPadNumbers.size(); ++i) {
+    for (std::size_t i = 0; i < position.mPadNumbers.size(); ++i) {
       os << position.mPadNumbers[i];
-      if (i < position.mPadNumbers.size() - 1) {
+      if (i + 1 < position.mPadNumbers.size()) {
         os << ",";
       }
     }
@@ -59,8 +59,6 @@ getMotifPositions(int segtype, bool bending, const Value &segmentations, const V
   std::vector<MotifPosition> motifpositions;
 
   auto mpArray = getMotifPositionArray(segtype, segmentations, bending);
-  auto mtArray = motiftypes.GetArray();
-  auto psArray = padsizes.GetArray();
 
   for (auto &mp: mpArray) {
 
@@ -86,7 +84,7 @@ getMotifPositions(int segtype, bool bending, const Value &segmentations, const V
     if (secondPadSizeId >= 0) {
       std::vector<int> padnumbers;
       auto pn = mp["padsize"].GetArray()[2]["pads"].GetArray();
-      for (int i = 0; i < pn.Size(); ++i) {
+      for (SizeType i = 0; i < pn.Size(); ++i) {
         padnumbers.push_back(pn[i].GetInt());
       }
       pos.secondPadSize(
@@ -16,6 +16,8 @@
 #include "motifPosition.h"
 #include "writer.h"
 #include "rapidjson/document.h"
+#include <algorithm>
+#include <cstddef>
 #include <iomanip>
 #include <sstream>
 #include <string>
@@ -79,24 +81,53 @@ std::pair<std::string, std::string> generateCodeForGetMotifPosition(int segtype,
 
   impl << decl.str() << "{\n return {\n";
 
-  int i{0};
+  std::size_t i{0};
   for (const auto &mp: motifPositions) {
     impl << "    " << mpClassName << " " << mp;
-    if (i++ < motifPositions.size() - 1) { impl << ",\n"; }
+    if (++i < motifPositions.size()) { impl << ",\n"; }
   }
   impl << "  };\n}\n";
 
   return {header.str(), impl.str()};
 }
 
-std::string generateCodeForMotifPositionTrait(int segtype, bool bending, int size)
+std::pair<std::string, std::string> generateCodeForMotifPositionTrait(int segtype, bool bending,
+                                                                      const std::vector<MotifPosition> &motifPositions)
 {
   std::ostringstream decl;
-  decl << "template<> struct MotifPositionTrait<" << segtype
-       << "," << bending << "> : MotifPositionBaseTrait<" << size << "," <<
+  std::ostringstream impl;
+
+  // dense dualSampaId -> motif position index table, starting at the
+  // smallest dualSampaId of the segmentation, with -1 for the holes
+  auto minmax = std::minmax_element(motifPositions.begin(), motifPositions.end(),
+                                    [](const MotifPosition &a, const MotifPosition &b) {
+                                      return a.FECId() < b.FECId();
+                                    });
+  int minId = minmax.first->FECId();
+  std::vector<int> indices(minmax.second->FECId() - minId + 1, -1);
+  for (std::size_t i = 0; i < motifPositions.size(); ++i) {
+    indices[motifPositions[i].FECId() - minId] = static_cast<int>(i);
+  }
+
+  std::ostringstream trait;
+  trait << "MotifPositionTrait<" << segtype << "," << bending << ">";
+  std::ostringstream tableType;
+  tableType << "std::array<int16_t," << indices.size() << ">";
+
+  decl << "template<> struct " << trait.str() << " : MotifPositionBaseTrait<" << motifPositions.size() << "," <<
        (segtype ? "MotifPosition" : "MotifPositionTwoPadSizes") << "," <<
-       (segtype < 2 ? "berg80ToManu" : "berg100ToManu") << "> {};\n";
-  return decl.str();
+       (segtype < 2 ? "berg80ToManu" : "berg100ToManu") << "> {\n";
+  decl << "  static constexpr int minDualSampaId{" << minId << "};\n";
+  decl << "  static constexpr " << tableType.str() << " dualSampaIndices{{";
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    decl << (i ? "," : "") << indices[i];
+  }
+  decl << "}};\n};\n";
+
+  impl << "constexpr int " << trait.str() << "::minDualSampaId;\n";
+  impl << "constexpr " << tableType.str() << " " << trait.str() << "::dualSampaIndices;\n";
+
+  return {decl.str(), impl.str()};
 }
 
 void generateCodeForMotifPositions(const Value &segmentations,
@@ -110,7 +141,7 @@ void generateCodeForMotifPositions(const Value &segmentations,
   impl << generateInclude({"sstream"});
   impl << mappingNamespaceBegin("impl1");
 
-  decl << generateInclude({"array"});
+  decl << generateInclude({"array", "cstdint"});
 
   for (auto i : {0, 1}) {
     auto p = generateCodeForBerg2Manu(bergs, i);
@@ -119,11 +150,13 @@ void generateCodeForMotifPositions(const Value &segmentations,
   }
 
   // then one trait and one template specialization per segmentation type
-  for (int segtype = 0; segtype < segmentations.GetArray().Size(); ++segtype) {
+  for (int segtype = 0; segtype < static_cast<int>(segmentations.GetArray().Size()); ++segtype) {
     for (auto bending: {true, false}) {
       std::vector<MotifPosition> motifpositions = getMotifPositions(segtype, bending, segmentations, motiftypes,
                                                                     padsizes);
-      decl << generateCodeForMotifPositionTrait(segtype, bending, motifpositions.size());
+      auto trait = generateCodeForMotifPositionTrait(segtype, bending, motifpositions);
+      decl << trait.first;
+      impl << trait.second;
       auto code = generateCodeForGetMotifPosition(segtype, bending, motifpositions);
       decl << code.first;
       impl << code.second;
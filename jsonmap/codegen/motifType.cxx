@@ -16,6 +16,8 @@
 #include "motifType.h"
 #include "jsonReader.h"
 #include "writer.h"
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <iostream>
 #include <iomanip>
@@ -27,12 +29,16 @@ namespace jsonmap {
 namespace codegen {
 
 namespace {
-std::string returnVectorAsString(const std::vector<int> &v)
+// the size of the lookup tables of the generated MotifType class
+constexpr int MaxBerg{100};
+constexpr int MaxNofIndices{256};
+
+std::string returnVectorAsString(const std::vector<int> &v, const std::string &type = "std::array<int,64>")
 {
 
   std::ostringstream s;
 
-  s << "std::array<int,64>{";
+  s << type << "{";
 
   for (std::vector<int>::size_type i = 0; i < v.size(); ++i) {
     s << std::setw(2) << v[i];
@@ -51,8 +57,6 @@ void generateCode(const Value &motif, std::ostringstream &code)
   const Value &pads = motif["pads"];
   assert(pads.IsArray());
 
-  unsigned int nofpads = pads.Size();
-
   std::vector<int> berg, ix, iy;
 
   for (const auto &p: pads.GetArray()) {
@@ -66,6 +70,26 @@ void generateCode(const Value &motif, std::ostringstream &code)
 
   std::string motifID = motif["id"].GetString();
 
+  // extents and lookup tables, where the first pad wins
+  // if several pads have the same berg or (ix,iy)
+  int nofPadsX = 1 + *std::max_element(ix.begin(), ix.end());
+  int nofPadsY = 1 + *std::max_element(iy.begin(), iy.end());
+  if (nofPadsX * nofPadsY > MaxNofIndices) {
+    throw std::out_of_range("motif type " + motifID + " has too many (ix,iy) cells");
+  }
+  std::vector<int> padIdByBerg(MaxBerg + 1, -1);
+  std::vector<int> padIdByIndices(MaxNofIndices, -1);
+  for (int i = berg.size() - 1; i >= 0; --i) {
+    if (berg[i] < 0 || berg[i] > MaxBerg) {
+      throw std::out_of_range("motif type " + motifID + " has an invalid berg number");
+    }
+    if (ix[i] < 0 || iy[i] < 0) {
+      throw std::out_of_range("motif type " + motifID + " has negative pad indices");
+    }
+    padIdByBerg[berg[i]] = i;
+    padIdByIndices[ix[i] + iy[i] * nofPadsX] = i;
+  }
+
   code << "/* " << motifID << " */  MotifType(\n  "
        << returnVectorAsString(berg)
        << ",\n  "
@@ -73,7 +97,11 @@ void generateCode(const Value &motif, std::ostringstream &code)
        << ",\n  "
        << returnVectorAsString(iy)
        << ",\n  "
-       << berg.size()
+       << berg.size() << "," << nofPadsX << "," << nofPadsY
+       << ",\n  "
+       << returnVectorAsString(padIdByBerg, "std::array<int8_t," + std::to_string(MaxBerg + 1) + ">")
+       << ",\n  "
+       << returnVectorAsString(padIdByIndices, "std::array<int8_t," + std::to_string(MaxNofIndices) + ">")
        << ")";
 }
 
@@ -83,10 +111,10 @@ std::string generateCodeForMotifTypes(const rapidjson::Value &motifs)
 
   std::ostringstream impl;
 
-  int n{0};
+  SizeType n{0};
   impl << generateInclude({"MotifType.h"});
   impl << mappingNamespaceBegin("impl1");
-  impl << "MotifTypeArray arrayOfMotifTypes{\n";
+  impl << "constexpr MotifTypeArray arrayOfMotifTypes{\n";
   for (const auto &motifType: motifs.GetArray()) {
     assert(motifType.IsObject());
     impl << "/* index: " << n << " */ ";
@@ -53,7 +53,7 @@ void getPosition(const MotifPosition &mp, const PadGroupType &pgt, double &x, do
 
   for (auto &s : special) {
     if (pgt.originalMotifTypeIdString == std::get<0>(s) &&
-        pgt.channelId.size() == std::get<1>(s)) {
+        pgt.channelId.size() == static_cast<std::size_t>(std::get<1>(s))) {
       x += std::get<2>(s);
       y += std::get<3>(s);
     }
@@ -135,7 +135,7 @@ getPadGroups(const std::vector<MotifPosition> &motifPositions, const std::vector
              const std::map<int, int> &manu2berg)
 {
   std::vector<PadGroup> pgs;
-  for (auto i = 0; i < motifPositions.size(); ++i) {
+  for (std::size_t i = 0; i < motifPositions.size(); ++i) {
     const auto &mp = motifPositions[i];
     for (auto &pgt : padGroupTypes) {
       if (pgt.originalMotifTypeId == mp.mMotifTypeId) {
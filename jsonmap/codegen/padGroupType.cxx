@@ -72,7 +72,7 @@ std::vector<int> PadGroupType::fastIndex() const
 
   fi.resize(nofPadsX() * nofPadsY(), -1);
 
-  for (auto i = 0; i < ix.size(); ++i) {
+  for (std::size_t i = 0; i < ix.size(); ++i) {
     fi[getIndex(ix[i], iy[i])] = channelId[i];
   }
   return fi;
@@ -123,7 +123,7 @@ int splitBetween(int regIndex, int nonRegIndex, const PadGroupType &input, PadGr
 
   std::vector<int> i1, i2;
 
-  for (auto i = 0; i < input.ix.size(); ++i) {
+  for (std::size_t i = 0; i < input.ix.size(); ++i) {
     bool mustSplit{false};
 
     if (isX && input.ix[i] >= valueLow && input.ix[i] <= valueHigh) {
@@ -188,8 +188,6 @@ getPadGroupTypes(int regIndex, int nonRegIndex, const rapidjson::Value &motifTyp
   assert(pads.IsArray());
   std::string motifID = motifType["id"].GetString();
 
-  unsigned int nofpads = pads.Size();
-
   PadGroupType v{regIndex, regIndex, motifID, false};
 
   for (const auto &p: pads.GetArray()) {
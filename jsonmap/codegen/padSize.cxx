@@ -49,7 +49,7 @@ std::string generateCodeForPadSizes(std::string ns, const rapidjson::Value &json
   code << R"(namespace {
 std::array<std::pair<double, double>, 18> arrayOfPadSizes{
 )";
-  int n{0};
+  std::size_t n{0};
   auto ps = getPadSizes(jsonPadSizes);
   for (auto &p: ps) {
     code << "/* " << n << " */ std::make_pair<double,double>(" << p.x << "," << p.y << ")";
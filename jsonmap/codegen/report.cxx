@@ -37,7 +37,7 @@ void reportNonRegularMotifs(const rapidjson::Value &segmentations, const rapidjs
   std::map<int, int> nonreg;
   std::set<int> regulars;
   std::set<int> all;
-  for (auto index = 0; index < segmentations.GetArray().Size(); ++index) {
+  for (int index = 0; index < static_cast<int>(segmentations.GetArray().Size()); ++index) {
     for (auto isBendingPlane: {true, false}) {
       std::vector <MotifPosition> motifpositions = getMotifPositions(index, isBendingPlane, segmentations, motiftypes,
                                                                      padsizes);
@@ -65,7 +65,7 @@ void reportIndicesRange(const rapidjson::Value &motiftypes)
   int iymax{0};
   int maxproduct{0};
   const auto &mts = motiftypes.GetArray();
-  for (auto i = 0; i < mts.Size(); ++i) {
+  for (rapidjson::SizeType i = 0; i < mts.Size(); ++i) {
     const rapidjson::Value &pads = mts[i]["pads"];
     int x{0};
     int y{0};
@@ -38,10 +38,6 @@ std::string generateCodeForSegmentationFactory(const Value &segmentations, const
 
   impl << mappingNamespaceBegin("impl1");
 
-  impl << generateCodeForDetElemIdArray(detection_elements);
-
-  impl << generateCodeForSegTypeArray(segmentations, detection_elements);
-
   impl << R"(
   std::unique_ptr<SegmentationInterface> getSegmentationByType(int type, bool isBendingPlane) {
 )";
@@ -50,7 +46,7 @@ std::string generateCodeForSegmentationFactory(const Value &segmentations, const
     for (auto b : std::array<bool, 2>{true, false}) {
       impl << "    if (isBendingPlane==" << (b ? "true" : "false") << " && type==" << i << ") {\n";
       impl << "      return std::unique_ptr<SegmentationInterface>{new Segmentation<" << i << ","
-           << (b ? "true" : "false") << ">{arrayOfMotifTypes}};\n";
+           << (b ? "true" : "false") << ">{}};\n";
       impl << "    };\n";
     }
   }
@@ -71,6 +67,7 @@ void generateCodeForSegmentations(const Value &segmentations, const Value &motif
   bool standalone{true};
   outputCode("", generateCodeForSegmentationFactory(segmentations, detection_elements), "SegmentationFactory",
              includeGuards, !standalone);
+  generateCodeForDetectionElementCatalogue(segmentations, motiftypes, detection_elements);
 }
 
 }}}
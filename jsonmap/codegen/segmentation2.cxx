@@ -47,9 +47,9 @@ padgroups(const std::vector<MotifPosition> &motifPositions, const std::vector<Pa
 
   code << "{\n";
 
-  for (auto i = 0; i < pgs.size(); ++i) {
+  for (std::size_t i = 0; i < pgs.size(); ++i) {
     code << pgs[i];
-    if (i < pgs.size() - 1) {
+    if (i + 1 < pgs.size()) {
       code << ",";
     }
     code << "\n";
@@ -60,48 +60,6 @@ padgroups(const std::vector<MotifPosition> &motifPositions, const std::vector<Pa
   return code.str();
 }
 
-std::string codeForDetElemId2SegType(const Value &segmentations,
-                                     const Value &detection_elements)
-{
-  std::stringstream impl;
-
-  impl << R"(
-int detElemId2SegType(int detElemId)
-{)";
-
-  impl << generateCodeForDetElemIdArray(detection_elements);
-  impl << generateCodeForSegTypeArray(segmentations, detection_elements);
-
-  impl << R"(
-  int detElemIndex = std::distance(detElemIndexToDetElemId.begin(),
-                                   std::find(detElemIndexToDetElemId.begin(), detElemIndexToDetElemId.end(),
-                                             detElemId));
-  return (detElemIndex>=0 && detElemIndex<156) ? detElemIndexToSegType[detElemIndex] : -1;
-}
-  )";
-  return impl.str();
-}
-
-void generateCodeForDetElemId2SegType(const std::string& ns, const Value &segmentation, const Value &detection_elements)
-{
-  bool includeGuards{true};
-  bool standalone{true};
-  std::stringstream decl, impl;
-
-  decl << mappingNamespaceBegin(ns);
-  decl << "int detElemId2SegType(int detElemId);";
-  decl << mappingNamespaceEnd(ns);
-
-  impl << generateInclude({"array","algorithm"});
-  impl << mappingNamespaceBegin(ns);
-  impl << codeForDetElemId2SegType(segmentation, detection_elements);
-  impl << mappingNamespaceEnd(ns);
-  outputCode(decl.str(), impl.str(),
-             "DetElemId2SegType",
-             includeGuards, !standalone);
-
-}
-
 std::map<int, int> getManu2Berg(const Value &bergs, bool is80pins)
 {
   auto berg2manu = getBerg2Manu(bergs, is80pins);
@@ -134,9 +92,9 @@ void output(std::ostream &code, PadGroupType &pgt)
   code << "{" << pgt.nofPadsX() << "," << pgt.nofPadsY() << ",";
   auto indices = pgt.fastIndex();
   code << "{";
-  for (auto i = 0; i < indices.size(); i++) {
+  for (std::size_t i = 0; i < indices.size(); i++) {
     code << indices[i];
-    if (i < indices.size() - 1) {
+    if (i + 1 < indices.size()) {
       code << ",";
     }
   }
@@ -148,9 +106,9 @@ template<typename T>
 void output(std::ostream &code, std::vector<T> &v)
 {
   code << "{";
-  for (auto i = 0; i < v.size(); i++) {
+  for (std::size_t i = 0; i < v.size(); i++) {
     output(code, v[i]);
-    if (i < v.size() - 1) {
+    if (i + 1 < v.size()) {
       code << ",";
     }
     code << "\n";
@@ -186,6 +144,15 @@ std::string getCodeForSegmentationCtor(const std::vector<MotifPosition> &motifPo
   return code.str();
 }
 
+/// Return the pad group lookup strategy for segType.
+/// Slats have their pad groups aligned in columns and rows, hence only
+/// a few cuts, while quadrants (segTypes 0 and 1) have irregular ones,
+/// better served by a uniform grid.
+std::string padGroupLookup(int segType)
+{
+  return segType < 2 ? "Grid" : "Cuts";
+}
+
 void
 generateCodeForSegmentationCreator(const std::string& ns, int segType, std::string codeForBendingCtor, std::string codeForNonBendingCtor)
 {
@@ -194,13 +161,18 @@ generateCodeForSegmentationCreator(const std::string& ns, int segType, std::stri
   impl << generateInclude({"SegmentationCreator.h"});
   impl << mappingNamespaceBegin(ns);
 
+  // the lookup strategy is chosen here, at code generation time
+  std::string lookup{"PadGroupLookup::" + padGroupLookup(segType)};
+
   std::string creatorName{"createSegType" + std::to_string(segType)};
   impl << "Segmentation* " << creatorName << "(bool isBendingPlane) {\n";
 
   impl << "  if (isBendingPlane) { \n";
-  impl << "    return new Segmentation{" << segType << ",true," << codeForBendingCtor << "};\n}\n";
+  impl << "    return new Segmentation{" << segType << ",true," << codeForBendingCtor << ","
+       << lookup << "};\n}\n";
   impl << "  else {\n ";
-  impl << "   return new Segmentation{" << segType << ",false," << codeForNonBendingCtor << "};\n}\n";
+  impl << "   return new Segmentation{" << segType << ",false," << codeForNonBendingCtor << ","
+       << lookup << "};\n}\n";
   impl << "}\n";
 
   auto registerName = "SegmentationCreatorRegisterC" + creatorName.substr(1);
@@ -265,7 +237,7 @@ void generateCodeForSegmentations(const std::string& ns,
                                   const Value &detection_elements,
                                   const Value &bergs)
 {
-  generateCodeForDetElemId2SegType(ns,segmentations, detection_elements);
+  generateCodeForDetectionElementCatalogue(segmentations, motiftypes, detection_elements);
   generateCodeForSegmentations2(ns,segmentations, motiftypes, padsizes, detection_elements, bergs);
 }
 }
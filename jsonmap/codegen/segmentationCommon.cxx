@@ -14,7 +14,10 @@
 
 
 #include "segmentationCommon.h"
+#include "writer.h"
 #include <algorithm>
+#include <cstring>
+#include <map>
 #include <sstream>
 #include <vector>
 
@@ -28,51 +31,145 @@ std::string genPrefix()
   return "Gen";
 }
 
-std::string generateCodeForDetElemIdArray(const rapidjson::Value &detection_elements)
+namespace {
+
+/// Return the index, within segmentations, of the segmentation of the detection element de
+int segTypeIndex(const Value &segmentations, const Value &de)
+{
+  for (SizeType i = 0; i < segmentations.Size(); ++i) {
+    if (!strcmp(segmentations.GetArray()[i]["segtype"].GetString(), de["segtype"].GetString())) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+/// Return the number of pads of one plane of a segmentation,
+/// i.e. the sum of the number of pads of its motif positions
+int nofPads(const Value &segmentation, bool isBendingPlane, const Value &motiftypes)
 {
-  assert(detection_elements.IsArray());
-  std::vector<int> deids;
+  int n{0};
+  const Value &plane = isBendingPlane ? segmentation["bending"] : segmentation["non-bending"];
+  for (const auto &mp: plane["motifpositions"].GetArray()) {
+    n += motiftypes.GetArray()[mp["motiftype"].GetInt()]["pads"].Size();
+  }
+  return n;
+}
+
+/// Return the number of dual sampas (i.e. of motif positions) of one plane of a segmentation
+int nofDualSampas(const Value &segmentation, bool isBendingPlane)
+{
+  const Value &plane = isBendingPlane ? segmentation["bending"] : segmentation["non-bending"];
+  return plane["motifpositions"].Size();
+}
+}
+
+std::string codeForDetectionElementCatalogue(const Value &segmentations, const Value &motiftypes,
+                                             const Value &detection_elements)
+{
+  std::vector<std::pair<int, int>> des; // (detElemId,segType), in detElemId order
   for (const auto &de: detection_elements.GetArray()) {
-    assert(de.IsObject());
-    assert(de["id"].IsInt());
-    deids.push_back(de["id"].GetInt());
+    des.emplace_back(de["id"].GetInt(), segTypeIndex(segmentations, de));
+  }
+  std::sort(des.begin(), des.end());
+
+  int nofChambers{0};
+  int maxNofDetectionElementsPerChamber{0};
+  for (auto &de: des) {
+    nofChambers = std::max(nofChambers, de.first / 100);
+    maxNofDetectionElementsPerChamber = std::max(maxNofDetectionElementsPerChamber, de.first % 100 + 1);
   }
 
-  std::ostringstream impl;
+  std::ostringstream code;
+
+  code << R"(
+/// Static description of a detection element
+struct DetectionElementInfo
+{
+    int detElemId;
+    int chamberId; ///< 1..NofChambers, i.e. detElemId/100
+    int segType;
+    int nofBendingPads;
+    int nofNonBendingPads;
+    int nofBendingDualSampas;
+    int nofNonBendingDualSampas;
+};
+)";
+
+  code << "\nconstexpr int NofDetectionElements{" << des.size() << "};\n";
+  code << "constexpr int NofSegTypes{" << segmentations.Size() << "};\n";
+  code << "constexpr int NofChambers{" << nofChambers << "};\n";
+  code << "constexpr int MaxNofDetectionElementsPerChamber{" << maxNofDetectionElementsPerChamber << "};\n";
+
+  code << "\n/// All the detection elements, in detElemId order (the position in this array being the detElemIndex)\n";
+  code << "constexpr std::array<DetectionElementInfo, NofDetectionElements> detectionElements{{\n";
+  for (std::size_t i = 0; i < des.size(); ++i) {
+    int detElemId = des[i].first;
+    int segType = des[i].second;
+    const Value &seg = segmentations.GetArray()[segType];
+    code << "  {" << detElemId << ", " << detElemId / 100 << ", " << segType
+         << ", " << nofPads(seg, true, motiftypes) << ", " << nofPads(seg, false, motiftypes)
+         << ", " << nofDualSampas(seg, true) << ", " << nofDualSampas(seg, false) << "}";
+    code << (i + 1 < des.size() ? ",\n" : "\n");
+  }
+  code << "}};\n";
 
-  std::sort(deids.begin(), deids.end());
+  std::vector<int> indices(nofChambers * maxNofDetectionElementsPerChamber, -1);
+  for (std::size_t i = 0; i < des.size(); ++i) {
+    indices[(des[i].first / 100 - 1) * maxNofDetectionElementsPerChamber + des[i].first % 100] = i;
+  }
+  code << "\n/// detElemIndex of detElemId, at position (detElemId/100-1)*MaxNofDetectionElementsPerChamber+detElemId%100\n";
+  code << "/// (-1 where there is no detection element)\n";
+  code << "constexpr std::array<int, NofChambers * MaxNofDetectionElementsPerChamber> detElemIdToDetElemIndex{{\n";
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    code << indices[i];
+    code << (i + 1 < indices.size() ? ((i + 1) % maxNofDetectionElementsPerChamber ? ", " : ",\n") : "\n");
+  }
+  code << "}};\n";
 
-  impl << "\n  const std::array<int," << deids.size() << "> detElemIndexToDetElemId{ \n";
-  for (auto i = 0; i < deids.size(); ++i) {
-    impl << deids[i];
-    if (i < deids.size() - 1) { impl << ","; }
+  std::map<int, int> firstDetElemIdOfSegType;
+  for (auto &de: des) {
+    firstDetElemIdOfSegType.emplace(de.second, de.first);
   }
-  impl << "};\n";
-  return impl.str();
+  code << "\n/// One detection element (the first one, in detElemId order) of each segmentation type\n";
+  code << "constexpr std::array<int, NofSegTypes> segType2DetElemId{{";
+  for (auto it = firstDetElemIdOfSegType.begin(); it != firstDetElemIdOfSegType.end(); ++it) {
+    code << (it != firstDetElemIdOfSegType.begin() ? ", " : "") << it->second;
+  }
+  code << "}};\n";
+
+  code << R"(
+/// Return the detElemIndex of detElemId, or -1 if there is no such detection element
+constexpr int detElemIndex(int detElemId)
+{
+  return (detElemId >= 100 && detElemId < (NofChambers + 1) * 100 &&
+          detElemId % 100 < MaxNofDetectionElementsPerChamber)
+         ? detElemIdToDetElemIndex[(detElemId / 100 - 1) * MaxNofDetectionElementsPerChamber + detElemId % 100]
+         : -1;
 }
 
-std::string generateCodeForSegTypeArray(const Value &segmentations, const Value &detection_elements)
+/// Return the segmentation type of detElemId, or -1 if there is no such detection element
+constexpr int detElemId2SegType(int detElemId)
 {
-  std::ostringstream impl;
-
-  impl << "\n  const std::array<int," << detection_elements.Size() << "> detElemIndexToSegType{";
-
-  for (int ide = 0; ide < detection_elements.GetArray().Size(); ++ide) {
-    const auto &de = detection_elements.GetArray()[ide];
-    for (int i = 0; i < segmentations.Size(); ++i) {
-      const auto &seg = segmentations.GetArray()[i];
-      if (!strcmp(seg["segtype"].GetString(), de["segtype"].GetString())) {
-        impl << i;
-        if (ide < detection_elements.GetArray().Size() - 1) { impl << ","; }
-        break;
-      }
-    }
-  }
+  return detElemIndex(detElemId) >= 0 ? detectionElements[detElemIndex(detElemId)].segType : -1;
+}
+)";
 
-  impl << "};\n";
+  return code.str();
+}
 
-  return impl.str();
+void generateCodeForDetectionElementCatalogue(const Value &segmentations, const Value &motiftypes,
+                                              const Value &detection_elements)
+{
+  bool includeGuards{true};
+  bool standalone{true};
+  std::stringstream decl;
+
+  decl << generateInclude({"array"});
+  decl << mappingNamespaceBegin("");
+  decl << codeForDetectionElementCatalogue(segmentations, motiftypes, detection_elements);
+  decl << mappingNamespaceEnd("");
+  outputCode(decl.str(), "", "DetectionElementCatalogue", includeGuards, standalone);
 }
 
 }}
-
@@ -22,8 +22,15 @@
 namespace jsonmap {
 namespace codegen {
 
-std::string generateCodeForDetElemIdArray(const rapidjson::Value &detection_elements);
-std::string generateCodeForSegTypeArray(const rapidjson::Value &segmentations, const rapidjson::Value &detection_elements);
+std::string codeForDetectionElementCatalogue(const rapidjson::Value &segmentations,
+                                             const rapidjson::Value &motiftypes,
+                                             const rapidjson::Value &detection_elements);
+
+/// Generate the detection element catalogue, in the o2::mch::mapping namespace,
+/// as it is shared by all the implementations
+void generateCodeForDetectionElementCatalogue(const rapidjson::Value &segmentations,
+                                              const rapidjson::Value &motiftypes,
+                                              const rapidjson::Value &detection_elements);
 
 std::string genPrefix();
 
@@ -32,12 +32,14 @@ std::string copyright()
 
 std::string mappingNamespaceBegin(std::string ns)
 {
-  return "\nnamespace o2 {\nnamespace mch {\nnamespace mapping {\nnamespace " + ns + " {\n";
+  std::string begin{"\nnamespace o2 {\nnamespace mch {\nnamespace mapping {\n"};
+  return ns.empty() ? begin : begin + "namespace " + ns + " {\n";
 }
 
 std::string mappingNamespaceEnd(std::string ns)
 {
-  return "\n} // namespace " + ns + "\n} // namespace mapping\n} // namespace mch\n} // namespace o2\n";
+  std::string end{"} // namespace mapping\n} // namespace mch\n} // namespace o2\n"};
+  return ns.empty() ? "\n" + end : "\n} // namespace " + ns + "\n" + end;
 }
 
 std::string includeGuardName(const std::string &filename)
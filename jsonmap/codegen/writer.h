@@ -17,6 +17,7 @@
 namespace jsonmap {
 namespace codegen {
 
+/// Open the o2::mch::mapping namespace and, if ns is not empty, its ns sub-namespace
 std::string mappingNamespaceBegin(const std::string ns);
 
 std::string mappingNamespaceEnd(const std::string ns);